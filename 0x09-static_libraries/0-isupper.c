@@ -1,4 +1,5 @@
 #include "main.h"
+#include "ctype_inline.h"
 
 /**
  * _isupper - uppercase letters
@@ -9,8 +10,5 @@
 
 int _isupper(int c)
 {
-	if (c >= 'A' && c <= 'Z')
-		return (1);
-	else
-		return (0);
+	return (_isupper_inline(c));
 }
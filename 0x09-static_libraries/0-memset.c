@@ -1,4 +1,30 @@
 #include "main.h"
+#include "kernels.h"
+
+static char *memset_resolve(char *s, char b, unsigned int n);
+static char *(*memset_impl)(char *, char, unsigned int) = memset_resolve;
+
+/**
+ * memset_resolve - picks the fastest _memset kernel on first use
+ * @s: starting address of memory to be filled
+ * @b: the desired value
+ * @n: number of bytes to be changed
+ *
+ * Return: s
+ */
+static char *memset_resolve(char *s, char b, unsigned int n)
+{
+	static char *(*const table[])(char *, char, unsigned int) = {
+		_memset_scalar,
+#if defined(__x86_64__)
+		_memset_sse2, _memset_avx2, _memset_avx512
+#endif
+	};
+
+	memset_impl = table[_cpu_level()];
+	return (memset_impl(s, b, n));
+}
+
 /**
  * _memset - fill a block of memory with a specific value
  * @s: starting address of memory to be filled
@@ -9,12 +35,5 @@
  */
 char *_memset(char *s, char b, unsigned int n)
 {
-	int i = 0;
-
-	for (; n > 0; i++)
-	{
-		s[i] = b;
-		n--;
-	}
-	return (s);
+	return (memset_impl(s, b, n));
 }
@@ -1,29 +1,16 @@
 #include "main.h"
+#include "kernels.h"
 /**
  * _strcat - concatenates two strings
  * @dest: input value
  * @src: input value
  *
- * Return: void
+ * Description: each call rescans dest; use _stpcpy() or _strlcat()
+ * to append many pieces in linear time
+ * Return: dest
  */
 char *_strcat(char *dest, char *src)
 {
-	int i;
-	int j;
-
-	i = 0;
-	while (dest[i] != '\0')
-	{
-		i++;
-	}
-	j = 0;
-	while (src[j] != '\0')
-	{
-		dest[i] = src[j];
-		i++;
-		j++;
-	}
-
-	dest[i] = '\0';
+	_stpcpy(dest + _strlen_sz(dest), src);
 	return (dest);
 }
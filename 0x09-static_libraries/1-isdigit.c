@@ -1,4 +1,5 @@
 #include "main.h"
+#include "ctype_inline.h"
 
 /**
  * _isdigit - checks for a digit (0 through 9)
@@ -7,5 +8,5 @@
  */
 int _isdigit(int c)
 {
-	return (c >= '0' && c <= '9');
+	return (_isdigit_inline(c));
 }
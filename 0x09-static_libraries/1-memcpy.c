@@ -1,4 +1,50 @@
 #include "main.h"
+#include "kernels.h"
+
+static char *memcpy_resolve(char *dest, char *src, unsigned int n);
+static char *(*memcpy_impl)(char *, char *, unsigned int) = memcpy_resolve;
+
+/**
+ * memcpy_resolve - picks the fastest _memcpy kernel on first use
+ * @dest: memory where is stored
+ * @src: memory where is copied
+ * @n: number of bytes
+ *
+ * Return: dest
+ */
+static char *memcpy_resolve(char *dest, char *src, unsigned int n)
+{
+	static char *(*const table[])(char *, char *, unsigned int) = {
+		_memcpy_scalar,
+#if defined(__x86_64__)
+		_memcpy_sse2, _memcpy_avx2, _memcpy_avx512
+#endif
+	};
+
+	memcpy_impl = table[_cpu_level()];
+	return (memcpy_impl(dest, src, n));
+}
+
+/**
+ * _memcpy_sz - _memcpy() for sizes that may not fit an unsigned int
+ * @dest: memory where is stored
+ * @src: memory where is copied
+ * @n: number of bytes
+ *
+ * Return: dest + n
+ */
+char *_memcpy_sz(char *dest, const char *src, size_t n)
+{
+	unsigned int chunk;
+
+	for (; n > 0; n -= chunk, dest += chunk, src += chunk)
+	{
+		chunk = n > 0x80000000UL ? 0x80000000U : n;
+		memcpy_impl(dest, (char *)src, chunk);
+	}
+	return (dest);
+}
+
 /**
  *_memcpy - a function that copies memory area
  *@dest: memory where is stored
@@ -9,13 +55,5 @@
  */
 char *_memcpy(char *dest, char *src, unsigned int n)
 {
-	int r = 0;
-	int i = n;
-
-	for (; r < i; r++)
-	{
-		dest[r] = src[r];
-		n--;
-	}
-	return (dest);
+	return (memcpy_impl(dest, src, n));
 }
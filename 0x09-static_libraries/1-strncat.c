@@ -1,4 +1,5 @@
 #include "main.h"
+#include "kernels.h"
 /**
  * _strncat - concatenate two strings
  * using at most n bytes from src
@@ -10,14 +11,10 @@
  */
 char *_strncat(char *dest, char *src, int n)
 {
-	int k;
+	size_t k;
 	int l;
 
-	k = 0;
-	while (dest[k] != '\0')
-	{
-		k++;
-	}
+	k = _strlen_sz(dest);
 	l = 0;
 	while (l < n && src[l] != '\0')
 	{
@@ -1,3 +1,4 @@
+#include <limits.h>
 #include "main.h"
 
 /**
@@ -5,25 +6,20 @@
  *
  * @s: the string to use.
  *
+ * Description: accepts what _strtol() accepts in base 10 (leading
+ * spaces, one optional sign, then digits). Values that do not fit
+ * an int are clamped to INT_MIN or INT_MAX.
+ *
  * Return: integer.
  */
 
 int _atoi(char *s)
 {
-	int sign = 1, i = 0;
-	unsigned int res = 0;
+	long n = _strtol(s, NULL, 10);
 
-	while (!(s[i] <= '9' && s[i] >= '0') && s[i] != '\0')
-	{
-		if (s[i] == '-')
-			sign *= -1;
-		i++;
-	}
-	while (s[i] <= '9' && (s[i] >= '0' && s[i] != '\0'))
-	{
-		res = (res * 10) + (s[i] - '0');
-		i++;
-	}
-	res *= sign;
-	return (res);
+	if (n > INT_MAX)
+		return (INT_MAX);
+	if (n < INT_MIN)
+		return (INT_MIN);
+	return (n);
 }
@@ -0,0 +1,35 @@
+#include <stdlib.h>
+#include "kernels.h"
+
+/**
+ * _cpu_level - detects the widest vector extension usable on this CPU
+ *
+ * Description: the result is computed once and cached. Setting the
+ * LIBALL_MAX_CPU environment variable to a lower level (0 to 3) caps
+ * it, which lets every kernel be exercised on a single machine.
+ *
+ * Return: one of CPU_SCALAR, CPU_SSE2, CPU_AVX2 or CPU_AVX512
+ */
+int _cpu_level(void)
+{
+	static int level = -1;
+	char *cap;
+	int l = CPU_SCALAR;
+
+	if (level >= 0)
+		return (level);
+#if defined(__x86_64__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f"))
+		l = CPU_AVX512;
+	else if (__builtin_cpu_supports("avx2"))
+		l = CPU_AVX2;
+	else
+		l = CPU_SSE2;
+#endif
+	cap = getenv("LIBALL_MAX_CPU");
+	if (cap != NULL && *cap >= '0' && *cap - '0' < l)
+		l = *cap - '0';
+	level = l;
+	return (level);
+}
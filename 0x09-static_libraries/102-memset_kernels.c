@@ -0,0 +1,134 @@
+#include "main.h"
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+/**
+ * _memset_scalar - fills memory one machine word at a time
+ * @s: starting address of memory to be filled
+ * @b: the desired value
+ * @n: number of bytes to be changed
+ *
+ * Return: s
+ */
+char *_memset_scalar(char *s, char b, unsigned int n)
+{
+	size_t i = 0;
+	unsigned long w = (unsigned char)b * (~0UL / 0xff);
+
+	for (; i < n && ((unsigned long)(s + i) & (sizeof(word_t) - 1)); i++)
+		s[i] = b;
+	for (; i + sizeof(word_t) <= n; i += sizeof(word_t))
+		*(word_t *)(s + i) = w;
+	for (; i < n; i++)
+		s[i] = b;
+	return (s);
+}
+
+#if defined(__x86_64__)
+/**
+ * _memset_sse2 - fills memory 16 bytes at a time
+ * @s: starting address of memory to be filled
+ * @b: the desired value
+ * @n: number of bytes to be changed
+ *
+ * Description: one unaligned store covers the head, the body is written
+ * with aligned (or non-temporal, for huge fills) stores and a final
+ * unaligned store ending at s + n covers the tail.
+ * Return: s
+ */
+__attribute__((target("sse2")))
+char *_memset_sse2(char *s, char b, unsigned int n)
+{
+	__m128i v;
+	size_t i, len = n;
+
+	if (len < 16)
+		return (_memset_scalar(s, b, n));
+	v = _mm_set1_epi8(b);
+	_mm_storeu_si128((__m128i *)s, v);
+	i = 16 - ((unsigned long)s & 15);
+	if (len >= MEM_NT_THRESHOLD)
+	{
+		for (; i + 16 <= len; i += 16)
+			_mm_stream_si128((__m128i *)(s + i), v);
+		_mm_sfence();
+	}
+	else
+	{
+		for (; i + 16 <= len; i += 16)
+			_mm_store_si128((__m128i *)(s + i), v);
+	}
+	_mm_storeu_si128((__m128i *)(s + len - 16), v);
+	return (s);
+}
+
+/**
+ * _memset_avx2 - fills memory 32 bytes at a time
+ * @s: starting address of memory to be filled
+ * @b: the desired value
+ * @n: number of bytes to be changed
+ *
+ * Return: s
+ */
+__attribute__((target("avx2")))
+char *_memset_avx2(char *s, char b, unsigned int n)
+{
+	__m256i v;
+	size_t i, len = n;
+
+	if (len < 32)
+		return (_memset_sse2(s, b, n));
+	v = _mm256_set1_epi8(b);
+	_mm256_storeu_si256((__m256i *)s, v);
+	i = 32 - ((unsigned long)s & 31);
+	if (len >= MEM_NT_THRESHOLD)
+	{
+		for (; i + 32 <= len; i += 32)
+			_mm256_stream_si256((__m256i *)(s + i), v);
+		_mm_sfence();
+	}
+	else
+	{
+		for (; i + 32 <= len; i += 32)
+			_mm256_store_si256((__m256i *)(s + i), v);
+	}
+	_mm256_storeu_si256((__m256i *)(s + len - 32), v);
+	return (s);
+}
+
+/**
+ * _memset_avx512 - fills memory 64 bytes at a time
+ * @s: starting address of memory to be filled
+ * @b: the desired value
+ * @n: number of bytes to be changed
+ *
+ * Return: s
+ */
+__attribute__((target("avx512f")))
+char *_memset_avx512(char *s, char b, unsigned int n)
+{
+	__m512i v;
+	size_t i, len = n;
+
+	if (len < 64)
+		return (_memset_avx2(s, b, n));
+	v = _mm512_set1_epi8(b);
+	_mm512_storeu_si512((void *)s, v);
+	i = 64 - ((unsigned long)s & 63);
+	if (len >= MEM_NT_THRESHOLD)
+	{
+		for (; i + 64 <= len; i += 64)
+			_mm512_stream_si512((void *)(s + i), v);
+		_mm_sfence();
+	}
+	else
+	{
+		for (; i + 64 <= len; i += 64)
+			_mm512_store_si512((void *)(s + i), v);
+	}
+	_mm512_storeu_si512((void *)(s + len - 64), v);
+	return (s);
+}
+#endif
@@ -0,0 +1,142 @@
+#include "main.h"
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+/**
+ * _memcpy_scalar - copies memory one machine word at a time
+ * @dest: memory where is stored
+ * @src: memory where is copied
+ * @n: number of bytes
+ *
+ * Return: dest
+ */
+char *_memcpy_scalar(char *dest, char *src, unsigned int n)
+{
+	size_t i = 0;
+
+	for (; i < n && ((unsigned long)(dest + i) & (sizeof(word_t) - 1)); i++)
+		dest[i] = src[i];
+	for (; i + sizeof(word_t) <= n; i += sizeof(word_t))
+		*(word_t *)(dest + i) = *(word_t *)(src + i);
+	for (; i < n; i++)
+		dest[i] = src[i];
+	return (dest);
+}
+
+#if defined(__x86_64__)
+/**
+ * _memcpy_sse2 - copies memory 16 bytes at a time
+ * @dest: memory where is stored
+ * @src: memory where is copied
+ * @n: number of bytes
+ *
+ * Description: stores are aligned on dest (non-temporal for huge
+ * copies), loads from src are unaligned. The head and tail are covered
+ * by overlapping unaligned moves.
+ * Return: dest
+ */
+__attribute__((target("sse2")))
+char *_memcpy_sse2(char *dest, char *src, unsigned int n)
+{
+	__m128i head, tail;
+	size_t i, len = n;
+
+	if (len < 16)
+		return (_memcpy_scalar(dest, src, n));
+	head = _mm_loadu_si128((__m128i *)src);
+	tail = _mm_loadu_si128((__m128i *)(src + len - 16));
+	i = 16 - ((unsigned long)dest & 15);
+	if (len >= MEM_NT_THRESHOLD)
+	{
+		for (; i + 16 <= len; i += 16)
+			_mm_stream_si128((__m128i *)(dest + i),
+					 _mm_loadu_si128((__m128i *)(src + i)));
+		_mm_sfence();
+	}
+	else
+	{
+		for (; i + 16 <= len; i += 16)
+			_mm_store_si128((__m128i *)(dest + i),
+					_mm_loadu_si128((__m128i *)(src + i)));
+	}
+	_mm_storeu_si128((__m128i *)dest, head);
+	_mm_storeu_si128((__m128i *)(dest + len - 16), tail);
+	return (dest);
+}
+
+/**
+ * _memcpy_avx2 - copies memory 32 bytes at a time
+ * @dest: memory where is stored
+ * @src: memory where is copied
+ * @n: number of bytes
+ *
+ * Return: dest
+ */
+__attribute__((target("avx2")))
+char *_memcpy_avx2(char *dest, char *src, unsigned int n)
+{
+	__m256i head, tail;
+	size_t i, len = n;
+
+	if (len < 32)
+		return (_memcpy_sse2(dest, src, n));
+	head = _mm256_loadu_si256((__m256i *)src);
+	tail = _mm256_loadu_si256((__m256i *)(src + len - 32));
+	i = 32 - ((unsigned long)dest & 31);
+	if (len >= MEM_NT_THRESHOLD)
+	{
+		for (; i + 32 <= len; i += 32)
+			_mm256_stream_si256((__m256i *)(dest + i),
+					    _mm256_loadu_si256((__m256i *)(src + i)));
+		_mm_sfence();
+	}
+	else
+	{
+		for (; i + 32 <= len; i += 32)
+			_mm256_store_si256((__m256i *)(dest + i),
+					   _mm256_loadu_si256((__m256i *)(src + i)));
+	}
+	_mm256_storeu_si256((__m256i *)dest, head);
+	_mm256_storeu_si256((__m256i *)(dest + len - 32), tail);
+	return (dest);
+}
+
+/**
+ * _memcpy_avx512 - copies memory 64 bytes at a time
+ * @dest: memory where is stored
+ * @src: memory where is copied
+ * @n: number of bytes
+ *
+ * Return: dest
+ */
+__attribute__((target("avx512f")))
+char *_memcpy_avx512(char *dest, char *src, unsigned int n)
+{
+	__m512i head, tail;
+	size_t i, len = n;
+
+	if (len < 64)
+		return (_memcpy_avx2(dest, src, n));
+	head = _mm512_loadu_si512((void *)src);
+	tail = _mm512_loadu_si512((void *)(src + len - 64));
+	i = 64 - ((unsigned long)dest & 63);
+	if (len >= MEM_NT_THRESHOLD)
+	{
+		for (; i + 64 <= len; i += 64)
+			_mm512_stream_si512((void *)(dest + i),
+					    _mm512_loadu_si512((void *)(src + i)));
+		_mm_sfence();
+	}
+	else
+	{
+		for (; i + 64 <= len; i += 64)
+			_mm512_store_si512((void *)(dest + i),
+					   _mm512_loadu_si512((void *)(src + i)));
+	}
+	_mm512_storeu_si512((void *)dest, head);
+	_mm512_storeu_si512((void *)(dest + len - 64), tail);
+	return (dest);
+}
+#endif
@@ -0,0 +1,92 @@
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+/*
+ * Every kernel below only issues loads aligned to their own width,
+ * starting from the block that contains s. An aligned load never
+ * crosses a page boundary, so reading past the terminator is safe.
+ */
+
+/**
+ * _strlen_word - string length, eight bytes per step
+ * @s: string
+ *
+ * Return: length
+ */
+size_t _strlen_word(const char *s)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	const char *p = (const char *)((unsigned long)s & ~(sizeof(word_t) - 1));
+	unsigned long v, m;
+
+	/* bytes in front of s are forced non-zero */
+	v = *(const word_t *)p | ~(~0UL << (8 * (s - p)));
+	while (!(m = WORD_HAS_ZERO(v)))
+	{
+		p += sizeof(word_t);
+		v = *(const word_t *)p;
+	}
+	return (p - s + __builtin_ctzl(m) / 8);
+#else
+	const char *p = s;
+
+	while (*p)
+		p++;
+	return (p - s);
+#endif
+}
+
+#if defined(__x86_64__)
+/**
+ * _strlen_sse2 - string length, sixteen bytes per step
+ * @s: string
+ *
+ * Return: length
+ */
+__attribute__((target("sse2")))
+size_t _strlen_sse2(const char *s)
+{
+	const char *p = (const char *)((unsigned long)s & ~15UL);
+	__m128i z = _mm_setzero_si128();
+	unsigned int m;
+
+	m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((__m128i *)p), z));
+	m >>= s - p;
+	if (m)
+		return (__builtin_ctz(m));
+	do {
+		p += 16;
+		m = _mm_movemask_epi8(_mm_cmpeq_epi8(
+			_mm_load_si128((__m128i *)p), z));
+	} while (!m);
+	return (p - s + __builtin_ctz(m));
+}
+
+/**
+ * _strlen_avx2 - string length, thirty-two bytes per step
+ * @s: string
+ *
+ * Return: length
+ */
+__attribute__((target("avx2")))
+size_t _strlen_avx2(const char *s)
+{
+	const char *p = (const char *)((unsigned long)s & ~31UL);
+	__m256i z = _mm256_setzero_si256();
+	unsigned int m;
+
+	m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+		_mm256_load_si256((__m256i *)p), z));
+	m >>= s - p;
+	if (m)
+		return (__builtin_ctz(m));
+	do {
+		p += 32;
+		m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+			_mm256_load_si256((__m256i *)p), z));
+	} while (!m);
+	return (p - s + __builtin_ctz(m));
+}
+#endif
@@ -0,0 +1,99 @@
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+/**
+ * _strchr_word - locates a character, eight bytes per step
+ * @s: string to search
+ * @c: character to find ('\0' finds the terminator)
+ *
+ * Description: a word is a hit when it holds either c or the
+ * terminator; only aligned words are read, as in _strlen_word().
+ * Return: pointer to the first c in s, or NULL
+ */
+char *_strchr_word(const char *s, char c)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	const char *p = (const char *)((unsigned long)s & ~(sizeof(word_t) - 1));
+	unsigned long cw = (unsigned char)c * WORD_ONES;
+	unsigned long v, m, pre = ~(~0UL << (8 * (s - p)));
+
+	/* bytes in front of s can match neither c nor the terminator */
+	v = *(const word_t *)p;
+	m = (WORD_HAS_ZERO(v | pre) | WORD_HAS_ZERO((v ^ cw) | pre));
+	while (!m)
+	{
+		p += sizeof(word_t);
+		v = *(const word_t *)p;
+		m = WORD_HAS_ZERO(v) | WORD_HAS_ZERO(v ^ cw);
+	}
+	p += __builtin_ctzl(m) / 8;
+#else
+	const char *p = s;
+
+	while (*p && *p != c)
+		p++;
+#endif
+	return (*p == c ? (char *)p : NULL);
+}
+
+#if defined(__x86_64__)
+/**
+ * _strchr_sse2 - locates a character, sixteen bytes per step
+ * @s: string to search
+ * @c: character to find ('\0' finds the terminator)
+ *
+ * Return: pointer to the first c in s, or NULL
+ */
+__attribute__((target("sse2")))
+char *_strchr_sse2(const char *s, char c)
+{
+	const char *p = (const char *)((unsigned long)s & ~15UL);
+	__m128i z = _mm_setzero_si128(), cv = _mm_set1_epi8(c), v;
+	unsigned int m;
+
+	v = _mm_load_si128((__m128i *)p);
+	m = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, z),
+					   _mm_cmpeq_epi8(v, cv)));
+	m = (m >> (s - p)) << (s - p);
+	while (!m)
+	{
+		p += 16;
+		v = _mm_load_si128((__m128i *)p);
+		m = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, z),
+						   _mm_cmpeq_epi8(v, cv)));
+	}
+	p += __builtin_ctz(m);
+	return (*p == c ? (char *)p : NULL);
+}
+
+/**
+ * _strchr_avx2 - locates a character, thirty-two bytes per step
+ * @s: string to search
+ * @c: character to find ('\0' finds the terminator)
+ *
+ * Return: pointer to the first c in s, or NULL
+ */
+__attribute__((target("avx2")))
+char *_strchr_avx2(const char *s, char c)
+{
+	const char *p = (const char *)((unsigned long)s & ~31UL);
+	__m256i z = _mm256_setzero_si256(), cv = _mm256_set1_epi8(c), v;
+	unsigned int m;
+
+	v = _mm256_load_si256((__m256i *)p);
+	m = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, z),
+						 _mm256_cmpeq_epi8(v, cv)));
+	m = (m >> (s - p)) << (s - p);
+	while (!m)
+	{
+		p += 32;
+		v = _mm256_load_si256((__m256i *)p);
+		m = _mm256_movemask_epi8(_mm256_or_si256(
+			_mm256_cmpeq_epi8(v, z), _mm256_cmpeq_epi8(v, cv)));
+	}
+	p += __builtin_ctz(m);
+	return (*p == c ? (char *)p : NULL);
+}
+#endif
@@ -0,0 +1,174 @@
+#include <string.h>
+#include "kernels.h"
+
+/**
+ * struct twoway_s - precomputed Two-Way state for one needle
+ * @l: needle length
+ * @ms: end of the left half of the critical factorization
+ * @p: shift applied after the left half matched
+ * @mem0: bytes known to match after such a shift (periodic needles)
+ * @byteset: bitmap of the bytes that occur in the needle
+ * @shift: one past the last position of each byte in the needle
+ *
+ * Description: everything fits on the stack, so the search runs in
+ * constant memory regardless of the needle length
+ */
+typedef struct twoway_s
+{
+	size_t l, ms, p, mem0;
+	unsigned char byteset[32];
+	size_t shift[256];
+} twoway_t;
+
+/**
+ * max_suffix - computes the maximal suffix of a needle
+ * @n: needle
+ * @l: needle length
+ * @per: receives the period of that suffix
+ * @rev: compare with the reversed byte order
+ *
+ * Return: index just before the maximal suffix (may wrap to SIZE_MAX)
+ */
+static size_t max_suffix(const unsigned char *n, size_t l, size_t *per,
+			 int rev)
+{
+	size_t ip = (size_t)-1, jp = 0, k = 1, p = 1;
+
+	while (jp + k < l)
+	{
+		if (n[ip + k] == n[jp + k])
+		{
+			if (k == p)
+			{
+				jp += p;
+				k = 1;
+			}
+			else
+				k++;
+		}
+		else if (rev ? n[ip + k] < n[jp + k] : n[ip + k] > n[jp + k])
+		{
+			jp += k;
+			k = 1;
+			p = jp - ip;
+		}
+		else
+		{
+			ip = jp++;
+			k = p = 1;
+		}
+	}
+	*per = p;
+	return (ip);
+}
+
+/**
+ * twoway_prepare - fills the Two-Way state for a needle
+ * @tw: state to fill
+ * @h: haystack, only used to stop early if it is shorter than @n
+ * @n: needle
+ *
+ * Return: 1, or 0 if the haystack is shorter than the needle
+ */
+static int twoway_prepare(twoway_t *tw, const unsigned char *h,
+			  const unsigned char *n)
+{
+	size_t l, ms, p, ms2, p2;
+
+	memset(tw->byteset, 0, sizeof(tw->byteset));
+	for (l = 0; n[l] && h[l]; l++)
+	{
+		tw->byteset[n[l] >> 3] |= 1 << (n[l] & 7);
+		tw->shift[n[l]] = l + 1;
+	}
+	if (n[l])
+		return (0);
+	ms = max_suffix(n, l, &p, 0);
+	ms2 = max_suffix(n, l, &p2, 1);
+	if (ms2 + 1 > ms + 1)
+	{
+		ms = ms2;
+		p = p2;
+	}
+	tw->l = l;
+	tw->ms = ms;
+	if (memcmp(n, n + p, ms + 1))
+	{
+		tw->mem0 = 0;
+		p = (ms > l - ms - 1 ? ms : l - ms - 1) + 1;
+	}
+	else
+		tw->mem0 = l - p;
+	tw->p = p;
+	return (1);
+}
+
+/**
+ * twoway_skip - bad-character shift for the byte under the needle's end
+ * @tw: needle state
+ * @c: haystack byte aligned with the last needle byte
+ * @mem: bytes already known to match
+ *
+ * Return: how far to advance, 0 if the window must be compared
+ */
+static size_t twoway_skip(const twoway_t *tw, unsigned char c, size_t mem)
+{
+	size_t k;
+
+	if (!(tw->byteset[c >> 3] & (1 << (c & 7))))
+		return (tw->l);
+	k = tw->l - tw->shift[c];
+	if (k && k < mem)
+		k = mem;
+	return (k);
+}
+
+/**
+ * _strstr_twoway - Crochemore-Perrin Two-Way substring search
+ * @haystack: string to search
+ * @needle: non-empty string to find
+ *
+ * Description: linear time, constant memory. The end of the haystack
+ * is discovered lazily, so a match near the start stays cheap.
+ * Return: pointer to the first occurrence, or NULL
+ */
+char *_strstr_twoway(const char *haystack, const char *needle)
+{
+	const unsigned char *h = (const unsigned char *)haystack;
+	const unsigned char *n = (const unsigned char *)needle, *z = h, *nul;
+	twoway_t tw;
+	size_t k, mem = 0;
+
+	if (!twoway_prepare(&tw, h, n))
+		return (NULL);
+	for (;; h += k)
+	{
+		if ((size_t)(z - h) < tw.l)
+		{
+			nul = memchr(z, 0, tw.l | 63);
+			z = nul ? nul : z + (tw.l | 63);
+			if ((size_t)(z - h) < tw.l)
+				return (NULL);
+		}
+		k = twoway_skip(&tw, h[tw.l - 1], mem);
+		if (k)
+		{
+			mem = 0;
+			continue;
+		}
+		for (k = tw.ms + 1 > mem ? tw.ms + 1 : mem; n[k] && n[k] == h[k]; k++)
+			;
+		if (n[k])
+		{
+			k -= tw.ms;
+			mem = 0;
+			continue;
+		}
+		for (k = tw.ms + 1; k > mem && n[k - 1] == h[k - 1]; k--)
+			;
+		if (k <= mem)
+			return ((char *)h);
+		k = tw.p;
+		mem = tw.mem0;
+	}
+}
@@ -0,0 +1,88 @@
+#include <string.h>
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+/**
+ * known_len - extends the run of non-NUL bytes known to follow h
+ * @h: haystack
+ * @have: bytes from h already known to be non-NUL
+ * @want: bytes the caller would like to be able to read
+ *
+ * Description: scans aligned 32-byte blocks only, so it never touches
+ * a page the haystack does not reach.
+ * Return: min(want, strlen(h)), or more if a block overshoots want
+ */
+__attribute__((target("avx2")))
+static size_t known_len(const char *h, size_t have, size_t want)
+{
+	const char *p;
+	unsigned int m;
+	__m256i z = _mm256_setzero_si256();
+
+	while (have < want)
+	{
+		p = (const char *)((unsigned long)(h + have) & ~31UL);
+		m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+			_mm256_load_si256((__m256i *)p), z));
+		m >>= (h + have) - p;
+		if (m)
+			return (have + __builtin_ctz(m));
+		have = p + 32 - h;
+	}
+	return (have);
+}
+
+/**
+ * _strstr_avx2 - substring search with a first/last byte prefilter
+ * @haystack: string to search
+ * @needle: string to find, at least two bytes long
+ *
+ * Description: each step tests 32 candidate positions at once by
+ * comparing the needle's first and last bytes; only positions where
+ * both agree are verified. When verification costs outgrow the bytes
+ * scanned (adversarial inputs) the rest is handed to Two-Way, so the
+ * whole search stays linear.
+ * Return: pointer to the first occurrence, or NULL
+ */
+__attribute__((target("avx2")))
+char *_strstr_avx2(const char *haystack, const char *needle)
+{
+	size_t m = _strlen_avx2(needle), i = 0, have = 0, work = 0, j;
+	__m256i first = _mm256_set1_epi8(needle[0]);
+	__m256i last = _mm256_set1_epi8(needle[m - 1]);
+	unsigned int mask;
+
+	for (; work <= 4 * i + 4096; i += 32)
+	{
+		have = known_len(haystack, have, i + m + 31);
+		if (have < i + m + 31)
+			break;
+		mask = _mm256_movemask_epi8(_mm256_and_si256(
+			_mm256_cmpeq_epi8(first,
+				_mm256_loadu_si256((__m256i *)(haystack + i))),
+			_mm256_cmpeq_epi8(last,
+				_mm256_loadu_si256((__m256i *)(haystack + i + m - 1)))));
+		for (; mask; mask &= mask - 1)
+		{
+			j = i + __builtin_ctz(mask);
+			if (!memcmp(haystack + j + 1, needle + 1, m - 2))
+				return ((char *)haystack + j);
+			work += m;
+		}
+	}
+	return (_strstr_twoway(haystack + i, needle));
+}
+#else
+/**
+ * _strstr_avx2 - substring search, Two-Way only on this architecture
+ * @haystack: string to search
+ * @needle: string to find
+ *
+ * Return: pointer to the first occurrence, or NULL
+ */
+char *_strstr_avx2(const char *haystack, const char *needle)
+{
+	return (_strstr_twoway(haystack, needle));
+}
+#endif
@@ -0,0 +1,52 @@
+#include "main.h"
+#include "kernels.h"
+
+/**
+ * _charset_compile - builds a reusable accept-set
+ * @set: set to fill
+ * @accept: bytes that belong to the set
+ */
+void _charset_compile(charset_t *set, char *accept)
+{
+	unsigned char c;
+
+	_memset((char *)set, 0, sizeof(*set));
+	for (; *accept; accept++)
+	{
+		c = *accept;
+		set->bits[c >> 3] |= 1 << (c & 7);
+		set->lut[(c & 15) + 16 * (c >> 7)] |= 1 << ((c >> 4) & 7);
+	}
+}
+
+/**
+ * _span_scalar - length of the prefix made only of set members
+ * @s: string to scan
+ * @set: compiled accept-set (never contains '\0')
+ *
+ * Return: index of the first byte not in the set
+ */
+size_t _span_scalar(const char *s, const charset_t *set)
+{
+	const unsigned char *p = (const unsigned char *)s;
+
+	while (set->bits[*p >> 3] & (1 << (*p & 7)))
+		p++;
+	return ((const char *)p - s);
+}
+
+/**
+ * _cspan_scalar - length of the prefix made only of non-members
+ * @s: string to scan
+ * @set: compiled accept-set
+ *
+ * Return: index of the first set member, or of the terminator
+ */
+size_t _cspan_scalar(const char *s, const charset_t *set)
+{
+	const unsigned char *p = (const unsigned char *)s;
+
+	while (*p && !(set->bits[*p >> 3] & (1 << (*p & 7))))
+		p++;
+	return ((const char *)p - s);
+}
@@ -0,0 +1,109 @@
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+/**
+ * member16 - classifies sixteen bytes against an accept-set
+ * @x: bytes to classify
+ * @lo: rows for bytes below 0x80, indexed by the low nibble
+ * @hi: rows for bytes from 0x80 up, indexed by the low nibble
+ *
+ * Description: the low nibble picks a row from @lo or @hi (pshufb
+ * yields 0 when bit 7 of the index is set, which selects the table),
+ * and a third lookup turns the high nibble into a bit within that row.
+ * Return: 0xff in every lane whose byte is in the set, 0 elsewhere
+ */
+__attribute__((target("ssse3")))
+static __m128i member16(__m128i x, __m128i lo, __m128i hi)
+{
+	const __m128i nib = _mm_set1_epi8(0x0f);
+	const __m128i pos = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+					  1, 2, 4, 8, 16, 32, 64, -128);
+	__m128i i = _mm_and_si128(x, _mm_set1_epi8((char)0x8f)), row, bit;
+
+	row = _mm_or_si128(_mm_shuffle_epi8(lo, i), _mm_shuffle_epi8(hi,
+			   _mm_xor_si128(i, _mm_set1_epi8((char)0x80))));
+	bit = _mm_shuffle_epi8(pos, _mm_and_si128(_mm_srli_epi16(x, 4), nib));
+	return (_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit));
+}
+
+/**
+ * _span_ssse3 - _span_scalar() sixteen bytes per step
+ * @s: string to scan
+ * @set: compiled accept-set (never contains '\0')
+ *
+ * Return: index of the first byte not in the set
+ */
+__attribute__((target("ssse3")))
+size_t _span_ssse3(const char *s, const charset_t *set)
+{
+	const char *p = (const char *)((unsigned long)s & ~15UL);
+	__m128i lo = _mm_loadu_si128((__m128i *)set->lut);
+	__m128i hi = _mm_loadu_si128((__m128i *)(set->lut + 16));
+	unsigned int m;
+
+	m = ~_mm_movemask_epi8(member16(_mm_load_si128((__m128i *)p), lo, hi));
+	m = ((m & 0xffff) >> (s - p)) << (s - p);
+	while (!m)
+	{
+		p += 16;
+		m = ~_mm_movemask_epi8(member16(_mm_load_si128((__m128i *)p),
+						lo, hi)) & 0xffff;
+	}
+	return (p + __builtin_ctz(m) - s);
+}
+
+/**
+ * _cspan_ssse3 - _cspan_scalar() sixteen bytes per step
+ * @s: string to scan
+ * @set: compiled accept-set
+ *
+ * Return: index of the first set member, or of the terminator
+ */
+__attribute__((target("ssse3")))
+size_t _cspan_ssse3(const char *s, const charset_t *set)
+{
+	const char *p = (const char *)((unsigned long)s & ~15UL);
+	__m128i lo = _mm_loadu_si128((__m128i *)set->lut);
+	__m128i hi = _mm_loadu_si128((__m128i *)(set->lut + 16));
+	__m128i z = _mm_setzero_si128(), x;
+	unsigned int m;
+
+	x = _mm_load_si128((__m128i *)p);
+	m = _mm_movemask_epi8(_mm_or_si128(member16(x, lo, hi),
+					   _mm_cmpeq_epi8(x, z)));
+	m = (m >> (s - p)) << (s - p);
+	while (!m)
+	{
+		p += 16;
+		x = _mm_load_si128((__m128i *)p);
+		m = _mm_movemask_epi8(_mm_or_si128(member16(x, lo, hi),
+						   _mm_cmpeq_epi8(x, z)));
+	}
+	return (p + __builtin_ctz(m) - s);
+}
+#else
+/**
+ * _span_ssse3 - portable stand-in for the SSSE3 kernel
+ * @s: string to scan
+ * @set: compiled accept-set
+ *
+ * Return: index of the first byte not in the set
+ */
+size_t _span_ssse3(const char *s, const charset_t *set)
+{
+	return (_span_scalar(s, set));
+}
+
+/**
+ * _cspan_ssse3 - portable stand-in for the SSSE3 kernel
+ * @s: string to scan
+ * @set: compiled accept-set
+ *
+ * Return: index of the first set member, or of the terminator
+ */
+size_t _cspan_ssse3(const char *s, const charset_t *set)
+{
+	return (_cspan_scalar(s, set));
+}
+#endif
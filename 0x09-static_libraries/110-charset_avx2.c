@@ -0,0 +1,115 @@
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+/**
+ * member32 - classifies thirty-two bytes against an accept-set
+ * @x: bytes to classify
+ * @lo: rows for bytes below 0x80, in both 128-bit lanes
+ * @hi: rows for bytes from 0x80 up, in both 128-bit lanes
+ *
+ * Description: the AVX2 twin of member16() in 109-charset_ssse3.c
+ * Return: 0xff in every lane whose byte is in the set, 0 elsewhere
+ */
+__attribute__((target("avx2")))
+static __m256i member32(__m256i x, __m256i lo, __m256i hi)
+{
+	const __m256i nib = _mm256_set1_epi8(0x0f);
+	const __m256i pos = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+					     1, 2, 4, 8, 16, 32, 64, -128,
+					     1, 2, 4, 8, 16, 32, 64, -128,
+					     1, 2, 4, 8, 16, 32, 64, -128);
+	__m256i i = _mm256_and_si256(x, _mm256_set1_epi8((char)0x8f)), row, bit;
+
+	row = _mm256_or_si256(_mm256_shuffle_epi8(lo, i), _mm256_shuffle_epi8(hi,
+			      _mm256_xor_si256(i, _mm256_set1_epi8((char)0x80))));
+	bit = _mm256_shuffle_epi8(pos,
+				  _mm256_and_si256(_mm256_srli_epi16(x, 4), nib));
+	return (_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit));
+}
+
+/**
+ * _span_avx2 - _span_scalar() thirty-two bytes per step
+ * @s: string to scan
+ * @set: compiled accept-set (never contains '\0')
+ *
+ * Return: index of the first byte not in the set
+ */
+__attribute__((target("avx2")))
+size_t _span_avx2(const char *s, const charset_t *set)
+{
+	const char *p = (const char *)((unsigned long)s & ~31UL);
+	__m256i lo = _mm256_broadcastsi128_si256(
+		_mm_loadu_si128((__m128i *)set->lut));
+	__m256i hi = _mm256_broadcastsi128_si256(
+		_mm_loadu_si128((__m128i *)(set->lut + 16)));
+	unsigned int m;
+
+	m = ~_mm256_movemask_epi8(member32(_mm256_load_si256((__m256i *)p),
+					   lo, hi));
+	m = (m >> (s - p)) << (s - p);
+	while (!m)
+	{
+		p += 32;
+		m = ~_mm256_movemask_epi8(member32(
+			_mm256_load_si256((__m256i *)p), lo, hi));
+	}
+	return (p + __builtin_ctz(m) - s);
+}
+
+/**
+ * _cspan_avx2 - _cspan_scalar() thirty-two bytes per step
+ * @s: string to scan
+ * @set: compiled accept-set
+ *
+ * Return: index of the first set member, or of the terminator
+ */
+__attribute__((target("avx2")))
+size_t _cspan_avx2(const char *s, const charset_t *set)
+{
+	const char *p = (const char *)((unsigned long)s & ~31UL);
+	__m256i lo = _mm256_broadcastsi128_si256(
+		_mm_loadu_si128((__m128i *)set->lut));
+	__m256i hi = _mm256_broadcastsi128_si256(
+		_mm_loadu_si128((__m128i *)(set->lut + 16)));
+	__m256i z = _mm256_setzero_si256(), x;
+	unsigned int m;
+
+	x = _mm256_load_si256((__m256i *)p);
+	m = _mm256_movemask_epi8(_mm256_or_si256(member32(x, lo, hi),
+						 _mm256_cmpeq_epi8(x, z)));
+	m = (m >> (s - p)) << (s - p);
+	while (!m)
+	{
+		p += 32;
+		x = _mm256_load_si256((__m256i *)p);
+		m = _mm256_movemask_epi8(_mm256_or_si256(member32(x, lo, hi),
+							 _mm256_cmpeq_epi8(x, z)));
+	}
+	return (p + __builtin_ctz(m) - s);
+}
+#else
+/**
+ * _span_avx2 - portable stand-in for the AVX2 kernel
+ * @s: string to scan
+ * @set: compiled accept-set
+ *
+ * Return: index of the first byte not in the set
+ */
+size_t _span_avx2(const char *s, const charset_t *set)
+{
+	return (_span_scalar(s, set));
+}
+
+/**
+ * _cspan_avx2 - portable stand-in for the AVX2 kernel
+ * @s: string to scan
+ * @set: compiled accept-set
+ *
+ * Return: index of the first set member, or of the terminator
+ */
+size_t _cspan_avx2(const char *s, const charset_t *set)
+{
+	return (_cspan_scalar(s, set));
+}
+#endif
@@ -0,0 +1,132 @@
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+/*
+ * The kernels below read whole words or vectors from both strings at
+ * unrelated alignments. A step that would reach into the next page of
+ * either string is done one byte at a time instead, so nothing past
+ * the terminator is read from a page the strings do not occupy.
+ */
+
+/**
+ * _strncmp_word - compares at most n bytes, eight bytes per step
+ * @s1: first string
+ * @s2: second string
+ * @n: maximum number of bytes to compare
+ *
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
+ */
+int _strncmp_word(const char *s1, const char *s2, size_t n)
+{
+	const unsigned char *a = (const unsigned char *)s1;
+	const unsigned char *b = (const unsigned char *)s2;
+	unsigned long x, y, m;
+	size_t i = 0;
+
+	while (i < n)
+	{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		if (!CROSSES_PAGE(a + i, 8) && !CROSSES_PAGE(b + i, 8))
+		{
+			x = *(const word_t *)(a + i);
+			y = *(const word_t *)(b + i);
+			m = (x ^ y) | WORD_HAS_ZERO(x);
+			if (!m)
+			{
+				i += 8;
+				continue;
+			}
+			i += __builtin_ctzl(m) / 8;
+			return (i < n ? a[i] - b[i] : 0);
+		}
+#endif
+		if (a[i] != b[i] || !a[i])
+			return (a[i] - b[i]);
+		i++;
+	}
+	return (0);
+}
+
+#if defined(__x86_64__)
+/**
+ * _strncmp_sse2 - compares at most n bytes, sixteen bytes per step
+ * @s1: first string
+ * @s2: second string
+ * @n: maximum number of bytes to compare
+ *
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
+ */
+__attribute__((target("sse2")))
+int _strncmp_sse2(const char *s1, const char *s2, size_t n)
+{
+	const unsigned char *a = (const unsigned char *)s1;
+	const unsigned char *b = (const unsigned char *)s2;
+	__m128i x, z = _mm_setzero_si128();
+	unsigned int m;
+	size_t i = 0;
+
+	while (i < n)
+	{
+		if (CROSSES_PAGE(a + i, 16) || CROSSES_PAGE(b + i, 16))
+		{
+			if (a[i] != b[i] || !a[i])
+				return (a[i] - b[i]);
+			i++;
+			continue;
+		}
+		x = _mm_loadu_si128((__m128i *)(a + i));
+		m = (~_mm_movemask_epi8(_mm_cmpeq_epi8(x,
+			_mm_loadu_si128((__m128i *)(b + i)))) & 0xffff) |
+			_mm_movemask_epi8(_mm_cmpeq_epi8(x, z));
+		if (m)
+		{
+			i += __builtin_ctz(m);
+			return (i < n ? a[i] - b[i] : 0);
+		}
+		i += 16;
+	}
+	return (0);
+}
+
+/**
+ * _strncmp_avx2 - compares at most n bytes, thirty-two bytes per step
+ * @s1: first string
+ * @s2: second string
+ * @n: maximum number of bytes to compare
+ *
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
+ */
+__attribute__((target("avx2")))
+int _strncmp_avx2(const char *s1, const char *s2, size_t n)
+{
+	const unsigned char *a = (const unsigned char *)s1;
+	const unsigned char *b = (const unsigned char *)s2;
+	__m256i x, z = _mm256_setzero_si256();
+	unsigned int m;
+	size_t i = 0;
+
+	while (i < n)
+	{
+		if (CROSSES_PAGE(a + i, 32) || CROSSES_PAGE(b + i, 32))
+		{
+			if (a[i] != b[i] || !a[i])
+				return (a[i] - b[i]);
+			i++;
+			continue;
+		}
+		x = _mm256_loadu_si256((__m256i *)(a + i));
+		m = ~_mm256_movemask_epi8(_mm256_cmpeq_epi8(x,
+			_mm256_loadu_si256((__m256i *)(b + i)))) |
+			_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, z));
+		if (m)
+		{
+			i += __builtin_ctz(m);
+			return (i < n ? a[i] - b[i] : 0);
+		}
+		i += 32;
+	}
+	return (0);
+}
+#endif
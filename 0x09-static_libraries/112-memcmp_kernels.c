@@ -0,0 +1,98 @@
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+/**
+ * _memcmp_word - compares two memory areas, eight bytes per step
+ * @s1: first area
+ * @s2: second area
+ * @n: number of bytes
+ *
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
+ */
+int _memcmp_word(const char *s1, const char *s2, size_t n)
+{
+	const unsigned char *a = (const unsigned char *)s1;
+	const unsigned char *b = (const unsigned char *)s2;
+	size_t i = 0;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	unsigned long m;
+
+	for (; i + 8 <= n; i += 8)
+	{
+		m = *(const word_t *)(a + i) ^ *(const word_t *)(b + i);
+		if (m)
+		{
+			i += __builtin_ctzl(m) / 8;
+			return (a[i] - b[i]);
+		}
+	}
+#endif
+	for (; i < n; i++)
+		if (a[i] != b[i])
+			return (a[i] - b[i]);
+	return (0);
+}
+
+#if defined(__x86_64__)
+/**
+ * _memcmp_sse2 - compares two memory areas, sixteen bytes per step
+ * @s1: first area
+ * @s2: second area
+ * @n: number of bytes
+ *
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
+ */
+__attribute__((target("sse2")))
+int _memcmp_sse2(const char *s1, const char *s2, size_t n)
+{
+	const unsigned char *a = (const unsigned char *)s1;
+	const unsigned char *b = (const unsigned char *)s2;
+	unsigned int m;
+	size_t i = 0;
+
+	for (; i + 16 <= n; i += 16)
+	{
+		m = ~_mm_movemask_epi8(_mm_cmpeq_epi8(
+			_mm_loadu_si128((__m128i *)(a + i)),
+			_mm_loadu_si128((__m128i *)(b + i)))) & 0xffff;
+		if (m)
+		{
+			i += __builtin_ctz(m);
+			return (a[i] - b[i]);
+		}
+	}
+	return (_memcmp_word(s1 + i, s2 + i, n - i));
+}
+
+/**
+ * _memcmp_avx2 - compares two memory areas, thirty-two bytes per step
+ * @s1: first area
+ * @s2: second area
+ * @n: number of bytes
+ *
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
+ */
+__attribute__((target("avx2")))
+int _memcmp_avx2(const char *s1, const char *s2, size_t n)
+{
+	const unsigned char *a = (const unsigned char *)s1;
+	const unsigned char *b = (const unsigned char *)s2;
+	unsigned int m;
+	size_t i = 0;
+
+	for (; i + 32 <= n; i += 32)
+	{
+		m = ~_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+			_mm256_loadu_si256((__m256i *)(a + i)),
+			_mm256_loadu_si256((__m256i *)(b + i))));
+		if (m)
+		{
+			i += __builtin_ctz(m);
+			return (a[i] - b[i]);
+		}
+	}
+	return (_memcmp_sse2(s1 + i, s2 + i, n - i));
+}
+#endif
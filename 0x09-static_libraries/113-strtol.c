@@ -0,0 +1,167 @@
+#include <errno.h>
+#include <limits.h>
+#include "main.h"
+#include "kernels.h"
+
+/**
+ * eight_digits - converts eight decimal digits with one multiply chain
+ * @p: text to convert
+ * @out: receives the value of p[0..7]
+ *
+ * Description: SWAR conversion; pairs, then quads, then the full
+ * eight digits are combined inside a single 64-bit word.
+ * Return: 1 if p starts with eight digits, 0 otherwise
+ */
+static int eight_digits(const char *p, unsigned long *out)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && __SIZEOF_LONG__ == 8
+	unsigned long v;
+
+	if (CROSSES_PAGE(p, 8))
+		return (0);
+	v = *(const word_t *)p;
+	if ((v & 0xf0f0f0f0f0f0f0f0UL) != 0x3030303030303030UL ||
+	    ((v + 0x0606060606060606UL) & 0xf0f0f0f0f0f0f0f0UL) !=
+	    0x3030303030303030UL)
+		return (0);
+	v -= 0x3030303030303030UL;
+	v = v * 10 + (v >> 8);
+	*out = ((v & 0x000000ff000000ffUL) * (100 + (1000000UL << 32)) +
+		((v >> 16) & 0x000000ff000000ffUL) * (1 + (10000UL << 32))) >> 32;
+	return (1);
+#else
+	(void)p;
+	(void)out;
+	return (0);
+#endif
+}
+
+/**
+ * digit_value - value of one digit in bases up to 36
+ * @c: character
+ *
+ * Return: 0-35, or 36 if c is not a digit in any base
+ */
+static int digit_value(char c)
+{
+	if (c >= '0' && c <= '9')
+		return (c - '0');
+	if (c >= 'a' && c <= 'z')
+		return (c - 'a' + 10);
+	if (c >= 'A' && c <= 'Z')
+		return (c - 'A' + 10);
+	return (36);
+}
+
+/**
+ * parse_magnitude - shared core of _strtol and _strtoul
+ * @s: text to parse
+ * @endptr: receives the first unparsed character, may be NULL
+ * @base: 2 to 36, or 0 to detect 0x / 0 prefixes
+ * @neg: receives 1 if a '-' sign was read
+ * @ovf: receives 1 if the magnitude does not fit an unsigned long
+ *
+ * Return: the magnitude, without the sign applied
+ */
+static unsigned long parse_magnitude(char *s, char **endptr, int base,
+				     int *neg, int *ovf)
+{
+	char *p = s, *digits;
+	unsigned long acc = 0, chunk;
+	int d;
+
+	while (*p == ' ' || (*p >= '\t' && *p <= '\r'))
+		p++;
+	*neg = (*p == '-');
+	p += (*p == '-' || *p == '+');
+	if ((base == 0 || base == 16) && p[0] == '0' && (p[1] | 32) == 'x' &&
+	    digit_value(p[2]) < 16)
+	{
+		p += 2;
+		base = 16;
+	}
+	else if (base == 0)
+		base = (p[0] == '0') ? 8 : 10;
+	for (digits = p; ; p++)
+	{
+		while (base == 10 && acc <= ULONG_MAX / 100000000 - 1 &&
+		       eight_digits(p, &chunk))
+		{
+			acc = acc * 100000000 + chunk;
+			p += 8;
+		}
+		d = digit_value(*p);
+		if (d >= base)
+			break;
+		if (acc > (ULONG_MAX - d) / base)
+			*ovf = 1;
+		acc = acc * base + d;
+	}
+	if (endptr != NULL)
+		*endptr = (p == digits) ? s : p;
+	return (acc);
+}
+
+/**
+ * _strtol - converts the start of a string to a long
+ * @s: text to parse
+ * @endptr: receives the first unparsed character, may be NULL
+ * @base: 2 to 36, or 0 to detect 0x / 0 prefixes
+ *
+ * Description: like strtol(3), an out-of-range value is clamped to
+ * LONG_MIN or LONG_MAX and errno is set to ERANGE; an invalid base
+ * sets errno to EINVAL.
+ * Return: the converted value
+ */
+long _strtol(char *s, char **endptr, int base)
+{
+	unsigned long mag, lim;
+	int neg = 0, ovf = 0;
+
+	if (base < 0 || base == 1 || base > 36)
+	{
+		errno = EINVAL;
+		if (endptr != NULL)
+			*endptr = s;
+		return (0);
+	}
+	mag = parse_magnitude(s, endptr, base, &neg, &ovf);
+	lim = neg ? (unsigned long)LONG_MAX + 1 : LONG_MAX;
+	if (ovf || mag > lim)
+	{
+		errno = ERANGE;
+		return (neg ? LONG_MIN : LONG_MAX);
+	}
+	return (neg ? (long)(0 - mag) : (long)mag);
+}
+
+/**
+ * _strtoul - converts the start of a string to an unsigned long
+ * @s: text to parse
+ * @endptr: receives the first unparsed character, may be NULL
+ * @base: 2 to 36, or 0 to detect 0x / 0 prefixes
+ *
+ * Description: like strtoul(3), a leading '-' negates the result and
+ * an out-of-range value returns ULONG_MAX with errno set to ERANGE.
+ * Return: the converted value
+ */
+unsigned long _strtoul(char *s, char **endptr, int base)
+{
+	unsigned long mag;
+	int neg = 0, ovf = 0;
+
+	if (base < 0 || base == 1 || base > 36)
+	{
+		errno = EINVAL;
+		if (endptr != NULL)
+			*endptr = s;
+		return (0);
+	}
+	mag = parse_magnitude(s, endptr, base, &neg, &ovf);
+	if (ovf)
+	{
+		errno = ERANGE;
+		return (ULONG_MAX);
+	}
+	return (neg ? 0 - mag : mag);
+}
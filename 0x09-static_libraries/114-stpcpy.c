@@ -0,0 +1,65 @@
+#include "main.h"
+#include "kernels.h"
+
+/**
+ * _stpcpy - copies a string and returns the end of the copy
+ * @dest: copy to
+ * @src: copy from
+ *
+ * Description: appending N pieces with
+ * end = _stpcpy(end, piece) costs O(total length), where repeated
+ * _strcat() calls rescan dest every time and cost O(N^2).
+ * Return: pointer to the terminating '\0' written in dest
+ */
+char *_stpcpy(char *dest, char *src)
+{
+	size_t len = _strlen_sz(src);
+
+	dest = _memcpy_sz(dest, src, len);
+	*dest = '\0';
+	return (dest);
+}
+
+/**
+ * _strlcpy - size-bounded string copy
+ * @dest: copy to
+ * @src: copy from
+ * @size: size of the dest buffer
+ *
+ * Description: copies at most size - 1 bytes and always terminates
+ * dest when size is not 0
+ * Return: strlen(src); a value >= size means the copy was truncated
+ */
+size_t _strlcpy(char *dest, char *src, size_t size)
+{
+	size_t len = _strlen_sz(src), n = len;
+
+	if (size == 0)
+		return (len);
+	if (n >= size)
+		n = size - 1;
+	_memcpy_sz(dest, src, n)[0] = '\0';
+	return (len);
+}
+
+/**
+ * _strlcat - size-bounded string concatenation
+ * @dest: string to append to
+ * @src: string to append
+ * @size: size of the dest buffer
+ *
+ * Description: the return value is the length of the string it tried
+ * to build, so callers can keep appending at dest + ret without
+ * rescanning while ret < size.
+ * Return: initial strlen(dest) (at most size) plus strlen(src)
+ */
+size_t _strlcat(char *dest, char *src, size_t size)
+{
+	size_t dlen = 0;
+
+	while (dlen < size && dest[dlen] != '\0')
+		dlen++;
+	if (dlen == size)
+		return (size + _strlen_sz(src));
+	return (dlen + _strlcpy(dest + dlen, src, size - dlen));
+}
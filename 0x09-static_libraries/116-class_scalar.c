@@ -0,0 +1,37 @@
+#include "kernels.h"
+
+/**
+ * _count_class_scalar - counts the bytes of a buffer in a class
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: number of bytes whose class bits intersect cls
+ */
+size_t _count_class_scalar(const char *buf, size_t n, int cls)
+{
+	const unsigned char *p = (const unsigned char *)buf;
+	size_t i, count = 0;
+
+	for (i = 0; i < n; i++)
+		count += (_ctype_bits[p[i]] & cls) != 0;
+	return (count);
+}
+
+/**
+ * _span_class_scalar - finds the first byte of a buffer not in a class
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: index of the first byte outside cls, or n
+ */
+size_t _span_class_scalar(const char *buf, size_t n, int cls)
+{
+	const unsigned char *p = (const unsigned char *)buf;
+	size_t i = 0;
+
+	while (i < n && (_ctype_bits[p[i]] & cls))
+		i++;
+	return (i);
+}
@@ -0,0 +1,118 @@
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+/**
+ * in_range16 - tests sixteen bytes against a range
+ * @x: bytes to test
+ * @lo: first byte of the range
+ * @len: number of bytes in the range
+ *
+ * Return: 0xff in every lane where lo <= x < lo + len, 0 elsewhere
+ */
+__attribute__((target("sse2")))
+static __m128i in_range16(__m128i x, char lo, char len)
+{
+	__m128i d = _mm_sub_epi8(x, _mm_set1_epi8(lo));
+
+	return (_mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(len - 1)), d));
+}
+
+/**
+ * class16 - classifies sixteen bytes
+ * @x: bytes to classify
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: 0xff in every lane whose byte is in cls, 0 elsewhere
+ */
+__attribute__((target("sse2")))
+static __m128i class16(__m128i x, int cls)
+{
+	__m128i m = _mm_setzero_si128();
+
+	if (cls & CT_UPPER)
+		m = _mm_or_si128(m, in_range16(x, 'A', 26));
+	if (cls & CT_LOWER)
+		m = _mm_or_si128(m, in_range16(x, 'a', 26));
+	if (cls & CT_DIGIT)
+		m = _mm_or_si128(m, in_range16(x, '0', 10));
+	return (m);
+}
+
+/**
+ * _count_class_sse2 - _count_class_scalar() sixteen bytes per step
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: number of bytes whose class bits intersect cls
+ */
+__attribute__((target("sse2")))
+size_t _count_class_sse2(const char *buf, size_t n, int cls)
+{
+	__m128i acc, sum, z = _mm_setzero_si128();
+	size_t i = 0, j, count = 0;
+
+	while (i + 16 <= n)
+	{
+		/* byte counters, folded with psadbw before they can wrap */
+		acc = z;
+		for (j = 0; j < 255 && i + 16 <= n; j++, i += 16)
+			acc = _mm_sub_epi8(acc, class16(
+				_mm_loadu_si128((__m128i *)(buf + i)), cls));
+		sum = _mm_sad_epu8(acc, z);
+		count += _mm_cvtsi128_si32(sum) + _mm_extract_epi16(sum, 4);
+	}
+	return (count + _count_class_scalar(buf + i, n - i, cls));
+}
+
+/**
+ * _span_class_sse2 - _span_class_scalar() sixteen bytes per step
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: index of the first byte outside cls, or n
+ */
+__attribute__((target("sse2")))
+size_t _span_class_sse2(const char *buf, size_t n, int cls)
+{
+	size_t i;
+	unsigned int m;
+
+	for (i = 0; i + 16 <= n; i += 16)
+	{
+		m = ~_mm_movemask_epi8(class16(
+			_mm_loadu_si128((__m128i *)(buf + i)), cls)) & 0xffff;
+		if (m)
+			return (i + __builtin_ctz(m));
+	}
+	return (i + _span_class_scalar(buf + i, n - i, cls));
+}
+#else
+/**
+ * _count_class_sse2 - portable stand-in for the SSE2 kernel
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: number of bytes whose class bits intersect cls
+ */
+size_t _count_class_sse2(const char *buf, size_t n, int cls)
+{
+	return (_count_class_scalar(buf, n, cls));
+}
+
+/**
+ * _span_class_sse2 - portable stand-in for the SSE2 kernel
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: index of the first byte outside cls, or n
+ */
+size_t _span_class_sse2(const char *buf, size_t n, int cls)
+{
+	return (_span_class_scalar(buf, n, cls));
+}
+#endif
@@ -0,0 +1,123 @@
+#include "kernels.h"
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+/**
+ * in_range32 - tests thirty-two bytes against a range
+ * @x: bytes to test
+ * @lo: first byte of the range
+ * @len: number of bytes in the range
+ *
+ * Return: 0xff in every lane where lo <= x < lo + len, 0 elsewhere
+ */
+__attribute__((target("avx2")))
+static __m256i in_range32(__m256i x, char lo, char len)
+{
+	__m256i d = _mm256_sub_epi8(x, _mm256_set1_epi8(lo));
+
+	return (_mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(len - 1)),
+				  d));
+}
+
+/**
+ * class32 - classifies thirty-two bytes
+ * @x: bytes to classify
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: 0xff in every lane whose byte is in cls, 0 elsewhere
+ */
+__attribute__((target("avx2")))
+static __m256i class32(__m256i x, int cls)
+{
+	__m256i m = _mm256_setzero_si256();
+
+	if (cls & CT_UPPER)
+		m = _mm256_or_si256(m, in_range32(x, 'A', 26));
+	if (cls & CT_LOWER)
+		m = _mm256_or_si256(m, in_range32(x, 'a', 26));
+	if (cls & CT_DIGIT)
+		m = _mm256_or_si256(m, in_range32(x, '0', 10));
+	return (m);
+}
+
+/**
+ * _count_class_avx2 - _count_class_scalar() thirty-two bytes per step
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: number of bytes whose class bits intersect cls
+ */
+__attribute__((target("avx2")))
+size_t _count_class_avx2(const char *buf, size_t n, int cls)
+{
+	__m256i acc, z = _mm256_setzero_si256();
+	__m128i sum;
+	size_t i = 0, j, count = 0;
+
+	while (i + 32 <= n)
+	{
+		/* byte counters, folded with vpsadbw before they can wrap */
+		acc = z;
+		for (j = 0; j < 255 && i + 32 <= n; j++, i += 32)
+			acc = _mm256_sub_epi8(acc, class32(
+				_mm256_loadu_si256((__m256i *)(buf + i)), cls));
+		acc = _mm256_sad_epu8(acc, z);
+		sum = _mm_add_epi64(_mm256_castsi256_si128(acc),
+				    _mm256_extracti128_si256(acc, 1));
+		count += _mm_cvtsi128_si64(sum) +
+			_mm_cvtsi128_si64(_mm_unpackhi_epi64(sum, sum));
+	}
+	return (count + _count_class_sse2(buf + i, n - i, cls));
+}
+
+/**
+ * _span_class_avx2 - _span_class_scalar() thirty-two bytes per step
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: index of the first byte outside cls, or n
+ */
+__attribute__((target("avx2")))
+size_t _span_class_avx2(const char *buf, size_t n, int cls)
+{
+	size_t i;
+	unsigned int m;
+
+	for (i = 0; i + 32 <= n; i += 32)
+	{
+		m = ~_mm256_movemask_epi8(class32(
+			_mm256_loadu_si256((__m256i *)(buf + i)), cls));
+		if (m)
+			return (i + __builtin_ctz(m));
+	}
+	return (i + _span_class_sse2(buf + i, n - i, cls));
+}
+#else
+/**
+ * _count_class_avx2 - portable stand-in for the AVX2 kernel
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: number of bytes whose class bits intersect cls
+ */
+size_t _count_class_avx2(const char *buf, size_t n, int cls)
+{
+	return (_count_class_scalar(buf, n, cls));
+}
+
+/**
+ * _span_class_avx2 - portable stand-in for the AVX2 kernel
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: index of the first byte outside cls, or n
+ */
+size_t _span_class_avx2(const char *buf, size_t n, int cls)
+{
+	return (_span_class_scalar(buf, n, cls));
+}
+#endif
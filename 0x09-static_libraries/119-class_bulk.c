@@ -0,0 +1,77 @@
+#include "main.h"
+#include "kernels.h"
+
+static size_t count_resolve(const char *buf, size_t n, int cls);
+static size_t span_resolve(const char *buf, size_t n, int cls);
+static size_t (*count_impl)(const char *, size_t, int) = count_resolve;
+static size_t (*span_impl)(const char *, size_t, int) = span_resolve;
+
+/**
+ * count_resolve - picks the fastest _count_class kernel on first use
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: number of bytes whose class bits intersect cls
+ */
+static size_t count_resolve(const char *buf, size_t n, int cls)
+{
+	static size_t (*const table[])(const char *, size_t, int) = {
+		_count_class_scalar,
+#if defined(__x86_64__)
+		_count_class_sse2, _count_class_avx2, _count_class_avx2
+#endif
+	};
+
+	count_impl = table[_cpu_level()];
+	return (count_impl(buf, n, cls));
+}
+
+/**
+ * span_resolve - picks the fastest _span_class kernel on first use
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: index of the first byte outside cls, or n
+ */
+static size_t span_resolve(const char *buf, size_t n, int cls)
+{
+	static size_t (*const table[])(const char *, size_t, int) = {
+		_span_class_scalar,
+#if defined(__x86_64__)
+		_span_class_sse2, _span_class_avx2, _span_class_avx2
+#endif
+	};
+
+	span_impl = table[_cpu_level()];
+	return (span_impl(buf, n, cls));
+}
+
+/**
+ * _count_class - counts the bytes of a buffer in a character class
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Description: _count_class(buf, n, CT_DIGIT) counts the digits
+ * Return: number of bytes whose class bits intersect cls
+ */
+size_t _count_class(const char *buf, size_t n, int cls)
+{
+	return (count_impl(buf, n, cls));
+}
+
+/**
+ * _span_class - finds the first byte of a buffer outside a class
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Description: _span_class(buf, n, CT_ALPHA) finds the first non-letter
+ * Return: index of the first byte outside cls, or n if there is none
+ */
+size_t _span_class(const char *buf, size_t n, int cls)
+{
+	return (span_impl(buf, n, cls));
+}
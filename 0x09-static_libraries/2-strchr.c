@@ -1,20 +1,37 @@
 #include "main.h"
+#include "kernels.h"
 #include <stddef.h>
 
+static char *strchr_resolve(const char *s, char c);
+static char *(*strchr_impl)(const char *, char) = strchr_resolve;
+
 /**
- * _strchr - Entry point
+ * strchr_resolve - picks the fastest _strchr kernel on first use
  * @s: input
  * @c: input
- * Return: Always 0 (Success)
+ *
+ * Return: pointer to the first c in s, or NULL
  */
-char *_strchr(char *s, char c)
+static char *strchr_resolve(const char *s, char c)
 {
-	int i = 0;
+	static char *(*const table[])(const char *, char) = {
+		_strchr_word,
+#if defined(__x86_64__)
+		_strchr_sse2, _strchr_avx2, _strchr_avx2
+#endif
+	};
 
-	for (; s[i] >= '\0'; i++)
-	{
-		if (s[i] == c)
-			return (&s[i]);
-	}
-	return (0);
+	strchr_impl = table[_cpu_level()];
+	return (strchr_impl(s, c));
+}
+
+/**
+ * _strchr - locates a character in a string
+ * @s: input
+ * @c: input ('\0' locates the terminator)
+ * Return: pointer to the first c in s, or NULL if it is not found
+ */
+char *_strchr(char *s, char c)
+{
+	return (strchr_impl(s, c));
 }
@@ -1,18 +1,47 @@
 #include "main.h"
+#include "kernels.h"
+
+static size_t strlen_resolve(const char *s);
+static size_t (*strlen_impl)(const char *) = strlen_resolve;
+
 /**
- * _strlen - returns the length of a string
+ * strlen_resolve - picks the fastest _strlen kernel on first use
  * @s: string
+ *
  * Return: length
  */
-int _strlen(char *s)
+static size_t strlen_resolve(const char *s)
 {
-	int longi = 0;
+	static size_t (*const table[])(const char *) = {
+		_strlen_word,
+#if defined(__x86_64__)
+		_strlen_sse2, _strlen_avx2, _strlen_avx2
+#endif
+	};
 
-	while (*s != '\0')
-	{
-		longi++;
-		s++;
-	}
+	strlen_impl = table[_cpu_level()];
+	return (strlen_impl(s));
+}
 
-	return (longi);
+/**
+ * _strlen_sz - returns the length of a string as a size_t
+ * @s: string
+ *
+ * Description: _strlen() for callers that must handle strings
+ * longer than INT_MAX
+ * Return: length
+ */
+size_t _strlen_sz(const char *s)
+{
+	return (strlen_impl(s));
+}
+
+/**
+ * _strlen - returns the length of a string
+ * @s: string
+ * Return: length
+ */
+int _strlen(char *s)
+{
+	return (strlen_impl(s));
 }
@@ -1,4 +1,5 @@
 #include "main.h"
+#include "ctype_inline.h"
 
 /**
  * _islower - checks for lowercase character
@@ -7,5 +8,5 @@
  */
 int _islower(int c)
 {
-	return (c >= 'a' && c <= 'z');
+	return (_islower_inline(c));
 }
@@ -0,0 +1,40 @@
+#include "main.h"
+#include "kernels.h"
+
+static int memcmp_resolve(const char *s1, const char *s2, size_t n);
+static int (*memcmp_impl)(const char *, const char *, size_t) =
+	memcmp_resolve;
+
+/**
+ * memcmp_resolve - picks the fastest _memcmp kernel on first use
+ * @s1: first area
+ * @s2: second area
+ * @n: number of bytes
+ *
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
+ */
+static int memcmp_resolve(const char *s1, const char *s2, size_t n)
+{
+	static int (*const table[])(const char *, const char *, size_t) = {
+		_memcmp_word,
+#if defined(__x86_64__)
+		_memcmp_sse2, _memcmp_avx2, _memcmp_avx2
+#endif
+	};
+
+	memcmp_impl = table[_cpu_level()];
+	return (memcmp_impl(s1, s2, n));
+}
+
+/**
+ * _memcmp - compare two memory areas
+ * @s1: first area
+ * @s2: second area
+ * @n: number of bytes
+ *
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
+ */
+int _memcmp(char *s1, char *s2, unsigned int n)
+{
+	return (memcmp_impl(s1, s2, n));
+}
@@ -1,23 +1,54 @@
 #include "main.h"
+#include "kernels.h"
+
+static int strncmp_resolve(const char *s1, const char *s2, size_t n);
+static int (*strncmp_impl)(const char *, const char *, size_t) =
+	strncmp_resolve;
+
+/**
+ * strncmp_resolve - picks the fastest string compare kernel on first use
+ * @s1: input value
+ * @s2: input value
+ * @n: maximum number of bytes to compare
+ *
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
+ */
+static int strncmp_resolve(const char *s1, const char *s2, size_t n)
+{
+	static int (*const table[])(const char *, const char *, size_t) = {
+		_strncmp_word,
+#if defined(__x86_64__)
+		_strncmp_sse2, _strncmp_avx2, _strncmp_avx2
+#endif
+	};
+
+	strncmp_impl = table[_cpu_level()];
+	return (strncmp_impl(s1, s2, n));
+}
+
 /**
  * _strcmp - compare string values
  * @s1: input value
  * @s2: input value
  *
- * Return: s1[i] - s2[i]
+ * Description: bytes compare as unsigned char and a proper prefix
+ * sorts before the longer string, as with strcmp(3)
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
  */
 int _strcmp(char *s1, char *s2)
 {
-	int i;
+	return (strncmp_impl(s1, s2, (size_t)-1));
+}
 
-	i = 0;
-	while (s1[i] != '\0' && s2[i] != '\0')
-	{
-		if (s1[i] != s2[i])
-		{
-			return (s1[i] - s2[i]);
-		}
-	i++;
-	}
-	return (0);
+/**
+ * _strncmp - compare at most n bytes of two strings
+ * @s1: input value
+ * @s2: input value
+ * @n: maximum number of bytes to compare
+ *
+ * Return: <0, 0 or >0 as s1 sorts before, equal to or after s2
+ */
+int _strncmp(char *s1, char *s2, int n)
+{
+	return (n > 0 ? strncmp_impl(s1, s2, n) : 0);
 }
@@ -1,28 +1,54 @@
 #include "main.h"
+#include "kernels.h"
+
+static size_t span_resolve(const char *s, const charset_t *set);
+static size_t (*span_impl)(const char *, const charset_t *) = span_resolve;
+
+/**
+ * span_resolve - picks the fastest span kernel on first use
+ * @s: input
+ * @set: compiled accept-set
+ *
+ * Return: length of the prefix of s made of set members
+ */
+static size_t span_resolve(const char *s, const charset_t *set)
+{
+	static size_t (*const table[])(const char *, const charset_t *) = {
+		_span_scalar,
+#if defined(__x86_64__)
+		_span_ssse3, _span_avx2, _span_avx2
+#endif
+	};
+
+	span_impl = table[_cpu_level()];
+#if defined(__x86_64__)
+	if (span_impl == _span_ssse3 && !__builtin_cpu_supports("ssse3"))
+		span_impl = _span_scalar;
+#endif
+	return (span_impl(s, set));
+}
+
+/**
+ * _strspn_set - gets the length of a prefix substring
+ * @s: input
+ * @set: accept-set compiled with _charset_compile()
+ * Return: number of bytes at the start of s that are in set
+ */
+unsigned int _strspn_set(char *s, const charset_t *set)
+{
+	return (span_impl(s, set));
+}
+
 /**
- * _strspn - Entry point
+ * _strspn - gets the length of a prefix substring
  * @s: input
  * @accept: input
- * Return: Always 0 (Success)
+ * Return: number of bytes at the start of s that occur in accept
  */
 unsigned int _strspn(char *s, char *accept)
 {
-	unsigned int n = 0;
-	int r;
+	charset_t set;
 
-	while (*s)
-	{
-		for (r = 0; accept[r]; r++)
-		{
-			if (*s == accept[r])
-			{
-				n++;
-				break;
-			}
-			else if (accept[r + 1] == '\0')
-				return (n);
-		}
-		s++;
-	}
-	return (n);
+	_charset_compile(&set, accept);
+	return (span_impl(s, &set));
 }
@@ -1,4 +1,5 @@
 #include "main.h"
+#include "ctype_inline.h"
 
 /**
  * _isalpha - checks for alphabetic character
@@ -7,5 +8,5 @@
  */
 int _isalpha(int c)
 {
-	return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'));
+	return (_isalpha_inline(c));
 }
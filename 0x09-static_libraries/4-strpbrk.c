@@ -1,23 +1,55 @@
 #include "main.h"
+#include "kernels.h"
+
+static size_t cspan_resolve(const char *s, const charset_t *set);
+static size_t (*cspan_impl)(const char *, const charset_t *) = cspan_resolve;
+
+/**
+ * cspan_resolve - picks the fastest complement-span kernel on first use
+ * @s: input
+ * @set: compiled accept-set
+ *
+ * Return: index of the first set member in s, or of its terminator
+ */
+static size_t cspan_resolve(const char *s, const charset_t *set)
+{
+	static size_t (*const table[])(const char *, const charset_t *) = {
+		_cspan_scalar,
+#if defined(__x86_64__)
+		_cspan_ssse3, _cspan_avx2, _cspan_avx2
+#endif
+	};
+
+	cspan_impl = table[_cpu_level()];
+#if defined(__x86_64__)
+	if (cspan_impl == _cspan_ssse3 && !__builtin_cpu_supports("ssse3"))
+		cspan_impl = _cspan_scalar;
+#endif
+	return (cspan_impl(s, set));
+}
+
+/**
+ * _strpbrk_set - searches a string for any of a set of bytes
+ * @s: input
+ * @set: accept-set compiled with _charset_compile()
+ * Return: pointer to the first byte of s in set, or NULL
+ */
+char *_strpbrk_set(char *s, const charset_t *set)
+{
+	s += cspan_impl(s, set);
+	return (*s ? s : NULL);
+}
+
 /**
- * _strpbrk - Entry point
+ * _strpbrk - searches a string for any of a set of bytes
  * @s: input
  * @accept: input
- * Return: Always 0 (Success)
+ * Return: pointer to the first byte of s in accept, or NULL
  */
 char *_strpbrk(char *s, char *accept)
 {
-	int k;
-
-	while (*s)
-	{
-		for (k = 0; accept[k]; k++)
-		{
-		if (*s == accept[k])
-		return (s);
-		}
-	s++;
-	}
+	charset_t set;
 
-return ('\0');
+	_charset_compile(&set, accept);
+	return (_strpbrk_set(s, &set));
 }
@@ -1,26 +1,42 @@
 #include "main.h"
+#include "kernels.h"
+
+static char *strstr_resolve(const char *haystack, const char *needle);
+static char *(*strstr_impl)(const char *, const char *) = strstr_resolve;
+
 /**
- * _strstr - Entry point
+ * strstr_resolve - picks the fastest _strstr kernel on first use
  * @haystack: input
- * @needle: input
- * Return: Always 0 (Success)
+ * @needle: input, at least two bytes long
+ *
+ * Return: pointer to the first occurrence, or NULL
  */
-char *_strstr(char *haystack, char *needle)
+static char *strstr_resolve(const char *haystack, const char *needle)
 {
-	for (; *haystack != '\0'; haystack++)
-	{
-		char *l = haystack;
-		char *p = needle;
-
-		while (*l == *p && *p != '\0')
-		{
-			l++;
-			p++;
-		}
+	static char *(*const table[])(const char *, const char *) = {
+		_strstr_twoway,
+#if defined(__x86_64__)
+		_strstr_twoway, _strstr_avx2, _strstr_avx2
+#endif
+	};
 
-		if (*p == '\0')
-			return (haystack);
-	}
+	strstr_impl = table[_cpu_level()];
+	return (strstr_impl(haystack, needle));
+}
 
-	return (0);
+/**
+ * _strstr - locates a substring
+ * @haystack: input
+ * @needle: input
+ *
+ * Description: runs in time linear in the haystack for any needle
+ * Return: pointer to the first occurrence of needle, or NULL
+ */
+char *_strstr(char *haystack, char *needle)
+{
+	if (needle[0] == '\0')
+		return (haystack);
+	if (needle[1] == '\0')
+		return (_strchr(haystack, needle[0]));
+	return (strstr_impl(haystack, needle));
 }
@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../main.h"
+
+#define HAY_LEN (16UL << 20)
+
+/**
+ * now_ns - reads the monotonic clock
+ *
+ * Return: nanoseconds
+ */
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/**
+ * run - times _strstr and strstr on one haystack/needle pair
+ * @name: label of the case
+ * @hay: haystack
+ * @needle: needle
+ */
+static void run(const char *name, char *hay, char *needle)
+{
+	double t0, t1, t2;
+	char *a, *b;
+	size_t len = strlen(hay);
+
+	t0 = now_ns();
+	a = _strstr(hay, needle);
+	t1 = now_ns();
+	b = strstr(hay, needle);
+	t2 = now_ns();
+	printf("%-12s _strstr %8.3f ns/B %7.2f GB/s | strstr %8.3f ns/B %7.2f GB/s%s\n",
+	       name, (t1 - t0) / len, len / (t1 - t0),
+	       (t2 - t1) / len, len / (t2 - t1), a == b ? "" : "  MISMATCH");
+}
+
+/**
+ * fill - fills a needle of length n with random lowercase letters
+ * @s: buffer of at least n + 1 bytes
+ * @n: length
+ */
+static void fill(char *s, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		s[i] = 'a' + rand() % 26;
+	s[n] = '\0';
+}
+
+/**
+ * main - benchmarks _strstr on short, long and adversarial needles
+ *
+ * Return: 0 on success, 1 on allocation failure
+ */
+int main(void)
+{
+	char *hay = malloc(HAY_LEN + 1), needle[1024];
+
+	if (hay == NULL)
+		return (1);
+	srand(98);
+	fill(hay, HAY_LEN);
+	fill(needle, 6);
+	run("short", hay, needle);
+	fill(needle, 512);
+	run("long", hay, needle);
+	memset(hay, 'a', HAY_LEN);
+	memset(needle, 'a', 999);
+	strcpy(needle + 999, "b");
+	run("adversarial", hay, needle);
+	strcpy(needle, "b");
+	memset(needle + 1, 'a', 999);
+	needle[1000] = '\0';
+	run("adv-rev", hay, needle);
+	free(hay);
+	return (0);
+}
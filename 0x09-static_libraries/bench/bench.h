@@ -0,0 +1,57 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+#include "../main.h"
+#include "../kernels.h"
+
+/* Largest buffer exercised, and the alignment offsets tried below it */
+#define MAX_SIZE (64UL << 20)
+#define MAX_ALIGN 64
+/* Each timing loop moves at least this many bytes */
+#define TIME_BYTES (64UL << 20)
+
+/* Reduces a comparison result to -1, 0 or 1 */
+#define SIGN(x) (((x) > 0) - ((x) < 0))
+
+/**
+ * TIME_NS - average time of one evaluation of an expression
+ * @out: receives nanoseconds per evaluation
+ * @n: bytes handled per evaluation, used to pick the repeat count
+ * @expr: expression to time
+ */
+#define TIME_NS(out, n, expr) do { \
+	size_t r_, k_ = reps_for(n); \
+	double t_ = now_ns(); \
+	for (r_ = 0; r_ < k_; r_++) \
+	{ \
+		expr; \
+		__asm__ __volatile__("" : : : "memory"); \
+	} \
+	(out) = (now_ns() - t_) / k_; \
+} while (0)
+
+extern int failures;
+extern volatile size_t sink;
+extern char *buf_a, *buf_b, *buf_c;
+extern const size_t sizes[];
+extern const size_t n_sizes;
+
+double now_ns(void);
+size_t reps_for(size_t n);
+char *buf_end(char *buf);
+void fill_random(char *p, size_t n, int alphabet);
+void report(const char *name, size_t n, double ours, double ref);
+void fail(const char *name, size_t n, size_t align, const char *what);
+int timed_size(size_t n);
+int aligns_for(size_t n);
+size_t align_at(size_t n, int a);
+
+void check_mem(void);
+void check_str(void);
+void check_search(void);
+void check_copy(void);
+void check_misc(void);
+void check_class(void);
+
+#endif
@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "bench.h"
+
+char *buf_a, *buf_b, *buf_c;
+
+/**
+ * buf_end - end of a test buffer, just before its guard page
+ * @buf: one of buf_a, buf_b or buf_c
+ *
+ * Return: one past the last usable byte
+ */
+char *buf_end(char *buf)
+{
+	return (buf + MAX_SIZE + 2 * 4096);
+}
+
+/**
+ * timed_size - tells whether a size is part of the timing table
+ * @n: size
+ *
+ * Return: 1 for 16 B, 256 B, 4 KiB, 64 KiB, 1 MiB, 16 MiB and 64 MiB
+ */
+int timed_size(size_t n)
+{
+	return (n == 16 || n == 256 || n == 4096 || n == 65536 ||
+		n == (1UL << 20) || n == (16UL << 20) || n == MAX_SIZE);
+}
+
+/**
+ * aligns_for - number of alignment offsets to check for a size
+ * @n: size
+ *
+ * Return: MAX_ALIGN for small sizes, 2 for the multi-megabyte ones
+ */
+int aligns_for(size_t n)
+{
+	return (n <= 65536 ? MAX_ALIGN : 2);
+}
+
+/**
+ * align_at - alignment offset number a for a size
+ * @n: size
+ * @a: 0 to aligns_for(n) - 1
+ *
+ * Return: a itself for small sizes, 0 or 33 for the large ones
+ */
+size_t align_at(size_t n, int a)
+{
+	return (n <= 65536 ? (size_t)a : (size_t)a * 33);
+}
+
+/**
+ * main - checks every liball.a routine against glibc and times it
+ *
+ * Description: each buffer is followed by a PROT_NONE page so that
+ * any read past the end of a string placed at buf_end() faults.
+ * Return: 0 if every result matched glibc, 1 otherwise
+ */
+int main(void)
+{
+	size_t len = MAX_SIZE + 3 * 4096;
+	char **b[3];
+	int i;
+
+	b[0] = &buf_a;
+	b[1] = &buf_b;
+	b[2] = &buf_c;
+	for (i = 0; i < 3; i++)
+	{
+		*b[i] = mmap(NULL, len, PROT_READ | PROT_WRITE,
+			     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (*b[i] == MAP_FAILED ||
+		    mprotect(buf_end(*b[i]), 4096, PROT_NONE) == -1)
+			return (1);
+	}
+	srand(1024);
+	printf("CPU level %d\n", _cpu_level());
+	check_mem();
+	check_str();
+	check_search();
+	check_copy();
+	check_misc();
+	check_class();
+	printf("%s: %d mismatch(es)\n", failures ? "FAIL" : "PASS", failures);
+	return (failures != 0);
+}
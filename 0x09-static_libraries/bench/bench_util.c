@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "bench.h"
+
+int failures;
+volatile size_t sink;
+
+const size_t sizes[] = {
+	0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 63, 64, 65,
+	100, 127, 128, 255, 256, 257, 1000, 4095, 4096, 4097, 65536,
+	1UL << 20, 4UL << 20, (4UL << 20) + 3, 16UL << 20, MAX_SIZE
+};
+const size_t n_sizes = sizeof(sizes) / sizeof(sizes[0]);
+
+/**
+ * now_ns - reads the monotonic clock
+ *
+ * Return: nanoseconds
+ */
+double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/**
+ * reps_for - repeat count that makes a timing loop move TIME_BYTES
+ * @n: bytes handled per call
+ *
+ * Return: number of calls to time
+ */
+size_t reps_for(size_t n)
+{
+	return (n >= TIME_BYTES ? 2 : TIME_BYTES / (n + 16));
+}
+
+/**
+ * fill_random - fills a buffer with non-zero pseudo-random bytes
+ * @p: buffer
+ * @n: number of bytes
+ * @alphabet: number of distinct bytes to draw from (1 to 255)
+ */
+void fill_random(char *p, size_t n, int alphabet)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		p[i] = (char)(1 + rand() % alphabet);
+}
+
+/**
+ * report - prints one timing line, ours against glibc
+ * @name: function measured
+ * @n: bytes per call
+ * @ours: ns per call of the liball.a function
+ * @ref: ns per call of the glibc function
+ */
+void report(const char *name, size_t n, double ours, double ref)
+{
+	double b = n ? (double)n : 1;
+
+	printf("%-10s %10lu B  %8.4f ns/B %8.2f GB/s | glibc %8.4f ns/B %8.2f GB/s\n",
+	       name, (unsigned long)n, ours / b, b / ours, ref / b, b / ref);
+}
+
+/**
+ * fail - records and prints a mismatch against glibc
+ * @name: function checked
+ * @n: size of the input
+ * @align: alignment offset of the input
+ * @what: description of the mismatch
+ */
+void fail(const char *name, size_t n, size_t align, const char *what)
+{
+	failures++;
+	printf("FAIL %s n=%lu align=%lu: %s\n", name, (unsigned long)n,
+	       (unsigned long)align, what);
+}
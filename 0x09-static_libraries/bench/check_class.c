@@ -0,0 +1,76 @@
+#include <ctype.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "../ctype_inline.h"
+
+/**
+ * in_class - glibc reference for the class bits
+ * @c: byte
+ * @cls: any combination of CT_UPPER, CT_LOWER and CT_DIGIT
+ *
+ * Return: 1 if c belongs to one of the classes in cls
+ */
+static int in_class(unsigned char c, int cls)
+{
+	return (((cls & CT_UPPER) && isupper(c)) ||
+		((cls & CT_LOWER) && islower(c)) ||
+		((cls & CT_DIGIT) && isdigit(c)));
+}
+
+/**
+ * check_bulk - checks _count_class and _span_class on one buffer
+ * @buf: bytes to classify
+ * @n: number of bytes
+ * @cls: class to test
+ */
+static void check_bulk(const char *buf, size_t n, int cls)
+{
+	size_t i, count = 0, span = n;
+
+	for (i = 0; i < n; i++)
+	{
+		if (in_class(buf[i], cls))
+			count++;
+		else if (span == n)
+			span = i;
+	}
+	if (_count_class(buf, n, cls) != count)
+		fail("_count_class", n, cls, "wrong count");
+	if (_span_class(buf, n, cls) != span)
+		fail("_span_class", n, cls, "wrong span");
+}
+
+/**
+ * check_class - checks the inline classifiers and the bulk scans
+ *
+ * Description: buffers are mostly letters and digits so that spans
+ * run for a while before the first byte outside the class
+ */
+void check_class(void)
+{
+	size_t s, n, i, acc = 0;
+	double ours, ref;
+	int c, cls;
+
+	for (c = -128; c < 256; c++)
+		if (_isupper_inline(c) != _isupper(c) ||
+		    _islower_inline(c) != _islower(c) ||
+		    _isalpha_inline(c) != _isalpha(c) ||
+		    _isdigit_inline(c) != _isdigit(c))
+			fail("_is*_inline", 1, c & 0xff, "differs from _is*");
+	for (i = 0; i < MAX_SIZE; i++)
+		buf_c[i] = rand() % 64 ? "aZ5"[rand() % 3] : (char)rand();
+	for (s = 0; s < n_sizes; s++)
+		for (cls = 1; cls < 8; cls++)
+			for (i = 0; i < (size_t)aligns_for(sizes[s]); i += 7)
+				check_bulk(buf_c + align_at(sizes[s], i), sizes[s], cls);
+	n = 1UL << 20;
+	TIME_NS(ours, n, sink += _count_class(buf_c, n, CT_DIGIT));
+	TIME_NS(ref, n, for (i = 0; i < n; i++)
+		acc += isdigit((unsigned char)buf_c[i]) != 0);
+	report("_count_cl", n, ours, ref);
+	TIME_NS(ours, n, for (i = 0; i < n; i++)
+		acc += _isdigit_inline((unsigned char)buf_c[i]));
+	report("_isdig_inl", n, ours, ref);
+	sink += acc;
+}
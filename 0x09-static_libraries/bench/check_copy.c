@@ -0,0 +1,120 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+/**
+ * reset - fills the destination areas of buf_a and buf_b
+ * @off: alignment offset of the destination
+ * @n: length of the source string
+ * @pre: length of a string already present at the destination
+ */
+static void reset(size_t off, size_t n, size_t pre)
+{
+	memset(buf_a, 'x', off + pre + n + 2 * MAX_ALIGN);
+	memset(buf_b, 'x', off + pre + n + 2 * MAX_ALIGN);
+	memset(buf_a + off, 'y', pre);
+	memset(buf_b + off, 'y', pre);
+	buf_a[off + pre] = '\0';
+	buf_b[off + pre] = '\0';
+}
+
+/**
+ * same - compares the destination areas of buf_a and buf_b
+ * @name: function checked
+ * @off: alignment offset of the destination
+ * @n: length of the source string
+ * @pre: length of the string that was already at the destination
+ */
+static void same(const char *name, size_t off, size_t n, size_t pre)
+{
+	if (memcmp(buf_a, buf_b, off + pre + n + 2 * MAX_ALIGN))
+		fail(name, n, off, "buffer differs");
+}
+
+/**
+ * check_cpy - checks _strcpy, _stpcpy, _strncpy and _strlcpy
+ * @s: source string
+ * @n: its length
+ * @off: alignment offset of the destination
+ */
+static void check_cpy(char *s, size_t n, size_t off)
+{
+	char *d = buf_a + off;
+	size_t k = n + off % 5, size = off % 3 ? rand() % (n + 2) : n + 1;
+
+	reset(off, n, 0);
+	_strcpy(d, s);
+	strcpy(buf_b + off, s);
+	same("_strcpy", off, n, 0);
+	if (_stpcpy(d, s) != d + n)
+		fail("_stpcpy", n, off, "wrong end pointer");
+	reset(off, n, 0);
+	_strncpy(d, s, k);
+	strncpy(buf_b + off, s, k);
+	same("_strncpy", off, n, 0);
+	reset(off, n, 0);
+	if (_strlcpy(d, s, size) != n)
+		fail("_strlcpy", n, off, "wrong return value");
+	if (size)
+	{
+		memcpy(buf_b + off, s, size - 1 < n ? size - 1 : n);
+		buf_b[off + (size - 1 < n ? size - 1 : n)] = '\0';
+	}
+	same("_strlcpy", off, n, 0);
+}
+
+/**
+ * check_cat - checks _strcat, _strncat and _strlcat
+ * @s: source string
+ * @n: its length
+ * @off: alignment offset of the destination
+ */
+static void check_cat(char *s, size_t n, size_t off)
+{
+	size_t pre = off % 7, k = rand() % (n + 2), size = pre + 1 + k;
+
+	reset(off, n, pre);
+	_strcat(buf_a + off, s);
+	strcat(buf_b + off, s);
+	same("_strcat", off, n, pre);
+	reset(off, n, pre);
+	_strncat(buf_a + off, s, k);
+	strncat(buf_b + off, s, k);
+	same("_strncat", off, n, pre);
+	reset(off, n, pre);
+	if (_strlcat(buf_a + off, s, size) != pre + n)
+		fail("_strlcat", n, off, "wrong return value");
+	strncat(buf_b + off, s, size - pre - 1);
+	same("_strlcat", off, n, pre);
+}
+
+/**
+ * check_copy - runs the string copy and concatenation checks
+ */
+void check_copy(void)
+{
+	size_t i, n, src;
+	double ours, ref;
+	int a;
+
+	fill_random(buf_c, MAX_SIZE + 2 * MAX_ALIGN, 200);
+	for (i = 0; i < n_sizes; i++)
+	{
+		n = sizes[i];
+		for (a = 0; a < aligns_for(n); a++)
+		{
+			src = (align_at(n, a) * 5) % MAX_ALIGN;
+			buf_c[src + n] = '\0';
+			check_cpy(buf_c + src, n, align_at(n, a));
+			check_cat(buf_c + src, n, align_at(n, a));
+			buf_c[src + n] = 'z';
+		}
+		if (!timed_size(n))
+			continue;
+		buf_c[n] = '\0';
+		TIME_NS(ours, n, sink += (size_t)_stpcpy(buf_a, buf_c));
+		TIME_NS(ref, n, sink += (size_t)stpcpy(buf_b, buf_c));
+		report("_stpcpy", n, ours, ref);
+		buf_c[n] = 'z';
+	}
+}
@@ -0,0 +1,107 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+/**
+ * check_memset - checks and times _memset against memset
+ * @n: size
+ */
+static void check_memset(size_t n)
+{
+	size_t off;
+	double ours, ref;
+	int a;
+
+	for (a = 0; a < aligns_for(n); a++)
+	{
+		off = align_at(n, a);
+		memset(buf_a, 'x', off + n + MAX_ALIGN);
+		memset(buf_b, 'x', off + n + MAX_ALIGN);
+		_memset(buf_a + off, (char)(0x80 + a), n);
+		memset(buf_b + off, 0x80 + a, n);
+		if (memcmp(buf_a, buf_b, off + n + MAX_ALIGN))
+			fail("_memset", n, off, "buffer differs");
+	}
+	if (!timed_size(n))
+		return;
+	TIME_NS(ours, n, _memset(buf_a, 1, n));
+	TIME_NS(ref, n, memset(buf_b, 1, n));
+	report("_memset", n, ours, ref);
+}
+
+/**
+ * check_memcpy - checks and times _memcpy against memcpy
+ * @n: size
+ */
+static void check_memcpy(size_t n)
+{
+	size_t off, src;
+	double ours, ref;
+	int a;
+
+	for (a = 0; a < aligns_for(n); a++)
+	{
+		off = align_at(n, a);
+		src = (off * 7) % MAX_ALIGN;
+		memset(buf_a, 0, off + n + MAX_ALIGN);
+		memset(buf_b, 0, off + n + MAX_ALIGN);
+		_memcpy(buf_a + off, buf_c + src, n);
+		memcpy(buf_b + off, buf_c + src, n);
+		if (memcmp(buf_a, buf_b, off + n + MAX_ALIGN))
+			fail("_memcpy", n, off, "buffer differs");
+	}
+	if (!timed_size(n))
+		return;
+	TIME_NS(ours, n, _memcpy(buf_a, buf_c, n));
+	TIME_NS(ref, n, memcpy(buf_b, buf_c, n));
+	report("_memcpy", n, ours, ref);
+}
+
+/**
+ * check_memcmp - checks and times _memcmp against memcmp
+ * @n: size
+ *
+ * Description: the copies are equal, or differ in one random byte
+ */
+static void check_memcmp(size_t n)
+{
+	size_t off, at;
+	double ours, ref;
+	int a;
+
+	for (a = 0; a < aligns_for(n); a++)
+	{
+		off = align_at(n, a);
+		memcpy(buf_a + off, buf_c, n);
+		if (n && a % 2)
+		{
+			at = rand() % n;
+			buf_a[off + at] ^= (char)(1 << (a % 8));
+		}
+		if (SIGN(_memcmp(buf_a + off, buf_c, n)) !=
+		    SIGN(memcmp(buf_a + off, buf_c, n)))
+			fail("_memcmp", n, off, "wrong ordering");
+	}
+	if (!timed_size(n))
+		return;
+	memcpy(buf_a, buf_c, n);
+	TIME_NS(ours, n, sink += _memcmp(buf_a, buf_c, n));
+	TIME_NS(ref, n, sink += memcmp(buf_a, buf_c, n));
+	report("_memcmp", n, ours, ref);
+}
+
+/**
+ * check_mem - runs the _mem* checks over every size
+ */
+void check_mem(void)
+{
+	size_t s;
+
+	fill_random(buf_c, MAX_SIZE + MAX_ALIGN, 255);
+	for (s = 0; s < n_sizes; s++)
+		check_memset(sizes[s]);
+	for (s = 0; s < n_sizes; s++)
+		check_memcpy(sizes[s]);
+	for (s = 0; s < n_sizes; s++)
+		check_memcmp(sizes[s]);
+}
@@ -0,0 +1,117 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+
+#define N_NUMBERS (1 << 20)
+
+/**
+ * check_classify - checks the _is* helpers on every byte and times them
+ */
+static void check_classify(void)
+{
+	double ours, ref;
+	size_t i, n = 1UL << 20, acc = 0;
+	int c;
+
+	for (c = -128; c < 256; c++)
+		if (!_isupper(c) != !(c >= 0 && isupper(c)) ||
+		    !_islower(c) != !(c >= 0 && islower(c)) ||
+		    !_isalpha(c) != !(c >= 0 && isalpha(c)) ||
+		    !_isdigit(c) != !(c >= 0 && isdigit(c)))
+			fail("_is*", 1, c & 0xff, "wrong class");
+	fill_random(buf_c, n, 255);
+	TIME_NS(ours, n, for (i = 0; i < n; i++)
+		acc += _isalpha((unsigned char)buf_c[i]));
+	TIME_NS(ref, n, for (i = 0; i < n; i++)
+		acc += isalpha((unsigned char)buf_c[i]) != 0);
+	report("_isalpha", n, ours, ref);
+	TIME_NS(ours, n, for (i = 0; i < n; i++)
+		acc += _isdigit((unsigned char)buf_c[i]));
+	TIME_NS(ref, n, for (i = 0; i < n; i++)
+		acc += isdigit((unsigned char)buf_c[i]) != 0);
+	report("_isdigit", n, ours, ref);
+	sink += acc;
+}
+
+/**
+ * check_abs - checks _abs against abs over random and boundary values
+ */
+static void check_abs(void)
+{
+	int i, v;
+
+	for (i = 0; i < N_NUMBERS; i++)
+	{
+		v = i < 3 ? i - 1 : rand() - RAND_MAX / 2;
+		if (_abs(v) != abs(v))
+			fail("_abs", 1, 0, "wrong value");
+	}
+	if (_abs(-2147483647) != 2147483647)
+		fail("_abs", 1, 0, "wrong value near INT_MIN");
+}
+
+/**
+ * make_numbers - writes newline-separated decimal numbers into buf_c
+ *
+ * Description: the numbers mix every length up to 20 digits, signs,
+ * leading blanks and out-of-range values
+ * Return: number of bytes written
+ */
+static size_t make_numbers(void)
+{
+	char *p = buf_c;
+	int i, len, d;
+
+	for (i = 0; i < N_NUMBERS; i++)
+	{
+		if (i % 5 == 0)
+			*p++ = ' ';
+		if (i % 3 == 0)
+			*p++ = i % 2 ? '-' : '+';
+		len = 1 + rand() % (i % 4 ? 10 : 21);
+		for (d = 0; d < len; d++)
+			*p++ = '0' + rand() % 10;
+		*p++ = '\n';
+	}
+	*--p = '\0';
+	return (p - buf_c);
+}
+
+/**
+ * check_numbers - checks _atoi, _strtol and _strtoul and times them
+ */
+static void check_numbers(void)
+{
+	char *p, *e1, *e2;
+	long l1, l2;
+	size_t n = make_numbers();
+	double ours, ref;
+
+	for (p = buf_c; *p; p = e1)
+	{
+		l1 = strtol(p, &e1, 10);
+		l2 = _strtol(p, &e2, 10);
+		if (l1 != l2 || e1 != e2)
+			fail("_strtol", e1 - p, 0, "wrong value or end");
+		if (_strtoul(p, &e2, 10) != strtoul(p, NULL, 10))
+			fail("_strtoul", e1 - p, 0, "wrong value");
+		if ((l1 >= -2147483647 - 1 && l1 <= 2147483647) && _atoi(p) != l1)
+			fail("_atoi", e1 - p, 0, "wrong value");
+	}
+	TIME_NS(ours, n, for (p = buf_c; *p; )
+		sink += _strtol(p, &p, 10));
+	TIME_NS(ref, n, for (p = buf_c; *p; )
+		sink += strtol(p, &p, 10));
+	report("_strtol", n, ours, ref);
+}
+
+/**
+ * check_misc - runs the classification and number parsing checks
+ */
+void check_misc(void)
+{
+	check_classify();
+	check_abs();
+	check_numbers();
+}
@@ -0,0 +1,141 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+/**
+ * place_str - copies n bytes of buf_c into buf_a as a string
+ * @n: string length
+ * @a: alignment number; -1 puts the terminator at the guard page
+ *
+ * Return: the string
+ */
+static char *place_str(size_t n, int a)
+{
+	char *s = a < 0 ? buf_end(buf_a) - n - 1 : buf_a + align_at(n, a);
+
+	memcpy(s, buf_c, n);
+	s[n] = '\0';
+	return (s);
+}
+
+/**
+ * check_strstr - checks and times _strstr against strstr
+ * @n: haystack length
+ *
+ * Description: the haystack only holds the bytes 1 and 2, which makes
+ * partial matches frequent; half of the needles are cut from it
+ */
+static void check_strstr(size_t n)
+{
+	char *h, needle[80];
+	size_t m, i;
+	double ours, ref;
+	int a;
+
+	for (a = -1; a < aligns_for(n); a++)
+	{
+		h = place_str(n, a);
+		m = 1 + rand() % (a % 4 ? 8 : 79);
+		for (i = 0; i < m; i++)
+			needle[i] = (char)(1 + rand() % 2);
+		if (m <= n && a % 2)
+			memcpy(needle, h + rand() % (n - m + 1), m);
+		needle[a == 5 ? 0 : m] = '\0';
+		if (_strstr(h, needle) != strstr(h, needle))
+			fail("_strstr", n, h - buf_a, "wrong match");
+	}
+	if (!timed_size(n))
+		return;
+	h = place_str(n, 0);
+	memset(needle, 1, 31);
+	needle[31] = 3;
+	needle[32] = '\0';
+	TIME_NS(ours, n, sink += (size_t)_strstr(h, needle));
+	TIME_NS(ref, n, sink += (size_t)strstr(h, needle));
+	report("_strstr", n, ours, ref);
+}
+
+/**
+ * check_strspn - checks and times _strspn and _strspn_set
+ * @n: string length
+ *
+ * Description: the string holds bytes 1-4 and 0x81-0x84, so both
+ * halves of the nibble lookup are exercised
+ */
+static void check_strspn(size_t n)
+{
+	const char full[] = "\1\2\3\4\201\202\203\204";
+	char acc[sizeof(full)], *s;
+	charset_t set;
+	double ours, ref;
+	int a;
+
+	for (a = -1; a < aligns_for(n); a++)
+	{
+		s = place_str(n, a);
+		memcpy(acc, full, sizeof(full));
+		acc[a % 2 ? 8 : 1 + rand() % 7] = '\0';
+		_charset_compile(&set, acc);
+		if (_strspn(s, acc) != strspn(s, acc) ||
+		    _strspn_set(s, &set) != strspn(s, acc))
+			fail("_strspn", n, s - buf_a, "wrong span");
+	}
+	if (!timed_size(n))
+		return;
+	s = place_str(n, 0);
+	memcpy(acc, full, sizeof(full));
+	_charset_compile(&set, acc);
+	TIME_NS(ours, n, sink += _strspn_set(s, &set));
+	TIME_NS(ref, n, sink += strspn(s, acc));
+	report("_strspn", n, ours, ref);
+}
+
+/**
+ * check_strpbrk - checks and times _strpbrk and _strpbrk_set
+ * @n: string length
+ */
+static void check_strpbrk(size_t n)
+{
+	char acc[3] = "\220\5", *s;
+	charset_t set;
+	double ours, ref;
+	int a;
+
+	for (a = -1; a < aligns_for(n); a++)
+	{
+		s = place_str(n, a);
+		acc[1] = (char)(n && a % 2 ? s[rand() % n] : 5);
+		_charset_compile(&set, acc);
+		if (_strpbrk(s, acc) != strpbrk(s, acc) ||
+		    _strpbrk_set(s, &set) != strpbrk(s, acc))
+			fail("_strpbrk", n, s - buf_a, "wrong match");
+	}
+	if (!timed_size(n))
+		return;
+	s = place_str(n, 0);
+	acc[1] = 5;
+	_charset_compile(&set, acc);
+	TIME_NS(ours, n, sink += (size_t)_strpbrk_set(s, &set));
+	TIME_NS(ref, n, sink += (size_t)strpbrk(s, acc));
+	report("_strpbrk", n, ours, ref);
+}
+
+/**
+ * check_search - runs the substring and accept-set checks
+ */
+void check_search(void)
+{
+	size_t s, i;
+
+	fill_random(buf_c, MAX_SIZE + MAX_ALIGN, 2);
+	for (s = 0; s < n_sizes; s++)
+		check_strstr(sizes[s]);
+	fill_random(buf_c, MAX_SIZE + MAX_ALIGN, 8);
+	for (i = 0; i < MAX_SIZE + MAX_ALIGN; i++)
+		if (buf_c[i] > 4)
+			buf_c[i] += 0x80 - 4;
+	for (s = 0; s < n_sizes; s++)
+		check_strspn(sizes[s]);
+	for (s = 0; s < n_sizes; s++)
+		check_strpbrk(sizes[s]);
+}
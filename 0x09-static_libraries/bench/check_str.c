@@ -0,0 +1,124 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+
+/**
+ * place - copies n bytes of buf_c into a buffer as a string
+ * @buf: buf_a or buf_b
+ * @n: string length
+ * @a: alignment number; -1 puts the terminator at the guard page
+ *
+ * Return: the string
+ */
+static char *place(char *buf, size_t n, int a)
+{
+	char *s = a < 0 ? buf_end(buf) - n - 1 : buf + align_at(n, a);
+
+	memcpy(s, buf_c, n);
+	s[n] = '\0';
+	return (s);
+}
+
+/**
+ * check_strlen - checks and times _strlen against strlen
+ * @n: string length
+ */
+static void check_strlen(size_t n)
+{
+	double ours, ref;
+	char *s;
+	int a;
+
+	for (a = -1; a < aligns_for(n); a++)
+	{
+		s = place(buf_a, n, a);
+		if ((size_t)_strlen(s) != strlen(s))
+			fail("_strlen", n, s - buf_a, "wrong length");
+	}
+	if (!timed_size(n))
+		return;
+	s = place(buf_a, n, 0);
+	TIME_NS(ours, n, sink += _strlen(s));
+	TIME_NS(ref, n, sink += strlen(s));
+	report("_strlen", n, ours, ref);
+}
+
+/**
+ * check_strchr - checks and times _strchr against strchr
+ * @n: string length
+ *
+ * Description: buf_c only holds bytes 1 to 200, so 201 is never found
+ */
+static void check_strchr(size_t n)
+{
+	double ours, ref;
+	char *s, c;
+	int a;
+
+	for (a = -1; a < aligns_for(n); a++)
+	{
+		s = place(buf_a, n, a);
+		c = n && a % 3 == 1 ? s[rand() % n] : (char)(a % 3 ? 201 : 0);
+		if (_strchr(s, c) != strchr(s, c))
+			fail("_strchr", n, s - buf_a, "wrong match");
+	}
+	if (!timed_size(n))
+		return;
+	s = place(buf_a, n, 0);
+	TIME_NS(ours, n, sink += (size_t)_strchr(s, (char)201));
+	TIME_NS(ref, n, sink += (size_t)strchr(s, 201));
+	report("_strchr", n, ours, ref);
+}
+
+/**
+ * check_strcmp - checks and times _strcmp and _strncmp
+ * @n: string length
+ *
+ * Description: the second string is equal, one byte shorter, or
+ * differs in one random byte, and sits at an unrelated alignment
+ */
+static void check_strcmp(size_t n)
+{
+	double ours, ref;
+	char *s, *t;
+	int a, k;
+
+	for (a = -1; a < aligns_for(n); a++)
+	{
+		s = place(buf_a, n, a);
+		t = place(buf_b, n, a < 0 ? 0 : (a * 5) % aligns_for(n));
+		if (n && a % 3 == 1)
+			t[n - 1] = '\0';
+		else if (n && a % 3 == 2)
+			t[rand() % n] ^= (char)0x80;
+		k = n ? rand() % (n + 1) : 0;
+		if (SIGN(_strcmp(s, t)) != SIGN(strcmp(s, t)) ||
+		    SIGN(_strcmp(t, s)) != SIGN(strcmp(t, s)))
+			fail("_strcmp", n, s - buf_a, "wrong ordering");
+		if (SIGN(_strncmp(s, t, k)) != SIGN(strncmp(s, t, k)))
+			fail("_strncmp", n, s - buf_a, "wrong ordering");
+	}
+	if (!timed_size(n))
+		return;
+	s = place(buf_a, n, 0);
+	t = place(buf_b, n, 3);
+	TIME_NS(ours, n, sink += _strcmp(s, t));
+	TIME_NS(ref, n, sink += strcmp(s, t));
+	report("_strcmp", n, ours, ref);
+}
+
+/**
+ * check_str - runs the length, search and compare checks
+ */
+void check_str(void)
+{
+	size_t s;
+
+	fill_random(buf_c, MAX_SIZE + MAX_ALIGN, 200);
+	for (s = 0; s < n_sizes; s++)
+		check_strlen(sizes[s]);
+	for (s = 0; s < n_sizes; s++)
+		check_strchr(sizes[s]);
+	for (s = 0; s < n_sizes; s++)
+		check_strcmp(sizes[s]);
+}
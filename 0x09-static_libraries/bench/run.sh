@@ -0,0 +1,16 @@
+#!/bin/bash
+# Checks every liball.a routine against glibc and prints ns/byte and GB/s.
+# Runs once per CPU level (scalar, SSE2, AVX2, AVX-512) the machine has.
+# Exits non-zero on the first level that reports a mismatch.
+set -e
+cd "$(dirname "$0")"
+out=$(mktemp -d)
+trap 'rm -rf "$out"' EXIT
+for f in ../*.c; do
+	gcc -Wall -pedantic -Werror -Wextra -O2 -c "$f" -o "$out/$(basename "${f%.c}").o"
+done
+ar -rc "$out/liball.a" "$out"/*.o
+gcc -Wall -pedantic -Werror -Wextra -O2 bench_*.c check_*.c "$out/liball.a" -o "$out/liball_check"
+for level in 0 1 2 3; do
+	LIBALL_MAX_CPU=$level "$out/liball_check"
+done
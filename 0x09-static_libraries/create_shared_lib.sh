@@ -0,0 +1,3 @@
+#!/bin/bash
+gcc -Wall -pedantic -Werror -Wextra -O3 -flto -fPIC -fvisibility=hidden -shared \
+	-Wl,--version-script=liball.map -Wl,-soname,liball.so -o liball.so *.c
@@ -1,4 +1,4 @@
 #!/bin/bash
-gcc -Wall -pedantic -Werror -Wextra -c *.c
-ar -rc liball.a *.o
-ranlib liball.a
+gcc -Wall -pedantic -Werror -Wextra -O3 -flto -ffat-lto-objects -c *.c
+gcc-ar -rc liball.a *.o
+gcc-ranlib liball.a
@@ -0,0 +1,57 @@
+#ifndef CTYPE_INLINE_H
+#define CTYPE_INLINE_H
+
+#include "main.h"
+
+/*
+ * Branchless, inlinable versions of the _is* helpers. Each one is a
+ * single load from _ctype_bits[] masked by a range check, so values
+ * outside 0-255 (EOF included) classify as 0.
+ */
+
+/**
+ * _isupper_inline - checks for an uppercase letter
+ * @c: character to check
+ *
+ * Return: 1 if c is in 'A'-'Z', 0 otherwise
+ */
+static __inline__ int _isupper_inline(int c)
+{
+	return (((unsigned int)c <= 255) & _ctype_bits[c & 255]);
+}
+
+/**
+ * _islower_inline - checks for a lowercase letter
+ * @c: character to check
+ *
+ * Return: 1 if c is in 'a'-'z', 0 otherwise
+ */
+static __inline__ int _islower_inline(int c)
+{
+	return (((unsigned int)c <= 255) & (_ctype_bits[c & 255] >> 1));
+}
+
+/**
+ * _isdigit_inline - checks for a decimal digit
+ * @c: character to check
+ *
+ * Return: 1 if c is in '0'-'9', 0 otherwise
+ */
+static __inline__ int _isdigit_inline(int c)
+{
+	return (((unsigned int)c <= 255) & (_ctype_bits[c & 255] >> 2));
+}
+
+/**
+ * _isalpha_inline - checks for a letter
+ * @c: character to check
+ *
+ * Return: 1 if c is a letter, 0 otherwise
+ */
+static __inline__ int _isalpha_inline(int c)
+{
+	return (((unsigned int)c <= 255) &
+		((_ctype_bits[c & 255] & CT_ALPHA) != 0));
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <stddef.h>
+#include "main.h"
+
+/*
+ * Internal helpers shared by the vectorized liball.a routines.
+ * Nothing in here is part of the public main.h interface.
+ */
+
+/* Copies and fills at least this large bypass the cache */
+#define MEM_NT_THRESHOLD (4UL << 20)
+
+/* True if a w-byte load at p would touch the next 4 KiB page */
+#define CROSSES_PAGE(p, w) (((unsigned long)(p) & 4095) > 4096 - (w))
+
+/* Instruction set levels reported by _cpu_level() */
+#define CPU_SCALAR 0
+#define CPU_SSE2 1
+#define CPU_AVX2 2
+#define CPU_AVX512 3
+
+/**
+ * word_t - machine word that may alias any other type
+ *
+ * Description: used by the word-at-a-time scalar paths so that
+ * reading a char buffer eight bytes at a time stays well defined,
+ * even from an address that is not word aligned
+ */
+typedef unsigned long __attribute__((__may_alias__, __aligned__(1))) word_t;
+
+/* Byte-replicated constants for the "has zero byte" bit trick */
+#define WORD_ONES (~0UL / 0xff)
+#define WORD_HIGHS (WORD_ONES << 7)
+/* Non-zero iff v has a zero byte; the lowest set bit marks the first */
+#define WORD_HAS_ZERO(v) (((v) - WORD_ONES) & ~(v) & WORD_HIGHS)
+
+int _cpu_level(void);
+
+char *_memset_scalar(char *s, char b, unsigned int n);
+char *_memset_sse2(char *s, char b, unsigned int n);
+char *_memset_avx2(char *s, char b, unsigned int n);
+char *_memset_avx512(char *s, char b, unsigned int n);
+
+char *_memcpy_scalar(char *dest, char *src, unsigned int n);
+char *_memcpy_sse2(char *dest, char *src, unsigned int n);
+char *_memcpy_avx2(char *dest, char *src, unsigned int n);
+char *_memcpy_avx512(char *dest, char *src, unsigned int n);
+
+size_t _strlen_sz(const char *s);
+char *_memcpy_sz(char *dest, const char *src, size_t n);
+
+size_t _strlen_word(const char *s);
+size_t _strlen_sse2(const char *s);
+size_t _strlen_avx2(const char *s);
+
+char *_strchr_word(const char *s, char c);
+char *_strchr_sse2(const char *s, char c);
+char *_strchr_avx2(const char *s, char c);
+
+char *_strstr_twoway(const char *haystack, const char *needle);
+char *_strstr_avx2(const char *haystack, const char *needle);
+
+size_t _span_scalar(const char *s, const charset_t *set);
+size_t _cspan_scalar(const char *s, const charset_t *set);
+size_t _span_ssse3(const char *s, const charset_t *set);
+size_t _cspan_ssse3(const char *s, const charset_t *set);
+size_t _span_avx2(const char *s, const charset_t *set);
+size_t _cspan_avx2(const char *s, const charset_t *set);
+
+int _strncmp_word(const char *s1, const char *s2, size_t n);
+int _strncmp_sse2(const char *s1, const char *s2, size_t n);
+int _strncmp_avx2(const char *s1, const char *s2, size_t n);
+
+int _memcmp_word(const char *s1, const char *s2, size_t n);
+int _memcmp_sse2(const char *s1, const char *s2, size_t n);
+int _memcmp_avx2(const char *s1, const char *s2, size_t n);
+
+size_t _count_class_scalar(const char *buf, size_t n, int cls);
+size_t _span_class_scalar(const char *buf, size_t n, int cls);
+size_t _count_class_sse2(const char *buf, size_t n, int cls);
+size_t _span_class_sse2(const char *buf, size_t n, int cls);
+size_t _count_class_avx2(const char *buf, size_t n, int cls);
+size_t _span_class_avx2(const char *buf, size_t n, int cls);
+
+#endif
@@ -1,5 +1,31 @@
 #ifndef MAIN_H
 #define MAIN_H
+
+#include <stddef.h>
+
+/**
+ * struct charset_s - precompiled accept-set for _strspn_set/_strpbrk_set
+ * @bits: 256-bit membership bitmap, bit (c & 7) of bits[c >> 3]
+ * @lut: nibble lookup, bit (c >> 4) & 7 of lut[(c & 15) + 16 * (c >> 7)]
+ *
+ * Description: fill it once with _charset_compile() and reuse it for
+ * as many scans as needed; both layouts hold the same set
+ */
+typedef struct charset_s
+{
+	unsigned char bits[32];
+	unsigned char lut[32];
+} charset_t;
+
+/* Class bits of _ctype_bits[], also the cls argument of the bulk scans */
+#define CT_UPPER 0x01
+#define CT_LOWER 0x02
+#define CT_DIGIT 0x04
+#define CT_ALPHA (CT_UPPER | CT_LOWER)
+
+/* Only the declarations below are exported when built with -fvisibility=hidden */
+#pragma GCC visibility push(default)
+extern const unsigned char _ctype_bits[256];
 int _putchar(char c);
 int _islower(int c);
 int _isalpha(int c);
@@ -9,15 +35,29 @@ int _isdigit(int c);
 int _strlen(char *s);
 void _puts(char *s);
 char *_strcpy(char *dest, char *src);
+char *_stpcpy(char *dest, char *src);
+size_t _strlcpy(char *dest, char *src, size_t size);
+size_t _strlcat(char *dest, char *src, size_t size);
 int _atoi(char *s);
+long _strtol(char *s, char **endptr, int base);
+unsigned long _strtoul(char *s, char **endptr, int base);
 char *_strcat(char *dest, char *src);
 char *_strncat(char *dest, char *src, int n);
 char *_strncpy(char *dest, char *src, int n);
 int _strcmp(char *s1, char *s2);
+int _strncmp(char *s1, char *s2, int n);
+int _memcmp(char *s1, char *s2, unsigned int n);
 char *_memset(char *s, char b, unsigned int n);
 char *_memcpy(char *dest, char *src, unsigned int n);
 char *_strchr(char *s, char c);
 unsigned int _strspn(char *s, char *accept);
 char *_strpbrk(char *s, char *accept);
 char *_strstr(char *haystack, char *needle);
+void _charset_compile(charset_t *set, char *accept);
+unsigned int _strspn_set(char *s, const charset_t *set);
+char *_strpbrk_set(char *s, const charset_t *set);
+size_t _count_class(const char *buf, size_t n, int cls);
+size_t _span_class(const char *buf, size_t n, int cls);
+#pragma GCC visibility pop
+
 #endif
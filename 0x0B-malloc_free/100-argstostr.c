@@ -1,40 +1,41 @@
 #include "main.h"
 #include <stdlib.h>
 /**
- * argstostr - main entry
+ * argstostr - concatenates all the arguments, one per line
  * @ac: int input
  * @av: double pointer array
- * Return: 0
+ *
+ * Description: the lengths are summed in a first pass, then every
+ * argument is appended at a running end pointer, so the result is
+ * built in one allocation and linear time
+ * Return: the new string, or NULL on failure
  */
 char *argstostr(int ac, char **av)
 {
-	int i, n, r = 0, l = 0;
-	char *str;
+	int i;
+	size_t l = 0;
+	char *str, *end, *s;
 
 	if (ac == 0 || av == NULL)
 		return (NULL);
 
 	for (i = 0; i < ac; i++)
 	{
-		for (n = 0; av[i][n]; n++)
-			l++;
+		for (s = av[i]; *s; s++)
+			;
+		l += s - av[i] + 1;
 	}
-	l += ac;
 
 	str = malloc(sizeof(char) * l + 1);
 	if (str == NULL)
 		return (NULL);
+	end = str;
 	for (i = 0; i < ac; i++)
 	{
-	for (n = 0; av[i][n]; n++)
-	{
-		str[r] = av[i][n];
-		r++;
-	}
-	if (str[r] == '\0')
-	{
-		str[r++] = '\n';
-	}
+		for (s = av[i]; *s; s++)
+			*end++ = *s;
+		*end++ = '\n';
 	}
+	*end = '\0';
 	return (str);
 }
@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <string.h>
+#include "lists.h"
+
+/**
+ * list_handle_init - prepares an empty list handle
+ * @h: handle to initialise
+ */
+void list_handle_init(list_handle_t *h)
+{
+	h->head = NULL;
+	h->tail = NULL;
+	h->count = 0;
+}
+
+/**
+ * list_handle_attach - wraps an existing list_t list in a handle
+ * @h: handle that takes over the list
+ * @head: head of the list, or NULL
+ *
+ * Return: number of nodes in the list
+ */
+size_t list_handle_attach(list_handle_t *h, list_t *head)
+{
+	list_handle_init(h);
+	h->head = head;
+	while (head)
+	{
+		h->tail = head;
+		h->count++;
+		head = head->next;
+	}
+
+	return (h->count);
+}
+
+/**
+ * list_handle_node - makes a node holding a copy of a string
+ * @str: string to duplicate into the node
+ * @next: node that follows the new one
+ *
+ * Return: address of the new node, or NULL if it failed
+ */
+static list_t *list_handle_node(const char *str, list_t *next)
+{
+	list_t *new;
+	size_t len = strlen(str);
+
+	new = malloc(sizeof(list_t));
+	if (!new)
+		return (NULL);
+
+	new->str = malloc(len + 1);
+	if (!new->str)
+	{
+		free(new);
+		return (NULL);
+	}
+	memcpy(new->str, str, len + 1);
+	new->len = len;
+	new->next = next;
+
+	return (new);
+}
+
+/**
+ * list_handle_append - adds a new node at the end of a list in O(1)
+ * @h: handle of the list
+ * @str: string to duplicate into the new node
+ *
+ * Return: address of the new element, or NULL if it failed
+ */
+list_t *list_handle_append(list_handle_t *h, const char *str)
+{
+	list_t *new = list_handle_node(str, NULL);
+
+	if (!new)
+		return (NULL);
+	if (h->tail)
+		h->tail->next = new;
+	else
+		h->head = new;
+	h->tail = new;
+	h->count++;
+
+	return (new);
+}
+
+/**
+ * list_handle_prepend - adds a new node at the beginning of a list
+ * @h: handle of the list
+ * @str: string to duplicate into the new node
+ *
+ * Return: address of the new element, or NULL if it failed
+ */
+list_t *list_handle_prepend(list_handle_t *h, const char *str)
+{
+	list_t *new = list_handle_node(str, h->head);
+
+	if (!new)
+		return (NULL);
+	h->head = new;
+	if (!h->tail)
+		h->tail = new;
+	h->count++;
+
+	return (new);
+}
@@ -0,0 +1,34 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "lists.h"
+
+/**
+ * main - check the code
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	list_handle_t h;
+	char *str;
+	int i;
+
+	list_handle_init(&h);
+	for (i = 0; i < 100000; i++)
+		list_handle_append(&h, "Betty");
+	list_handle_prepend(&h, "Anne");
+	list_handle_append(&h, "Walton");
+	printf("len = %lu\n", (unsigned long)list_handle_len(&h));
+	list_handle_free(&h);
+	list_handle_append(&h, "Holden");
+	list_handle_append(&h, "Ian");
+	str = list_handle_pop(&h);
+	printf("popped %s\n", str);
+	free(str);
+	list_handle_append(&h, "Julien");
+	print_list(h.head);
+	printf("len = %lu\n", (unsigned long)list_handle_len(&h));
+	list_handle_free(&h);
+	return (0);
+}
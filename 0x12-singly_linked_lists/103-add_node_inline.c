@@ -0,0 +1,85 @@
+#include <stdlib.h>
+#include <string.h>
+#include "lists.h"
+
+/**
+ * new_inline_node - allocates a node with its string stored after it
+ * @str: string to copy into the node
+ *
+ * Description: one malloc holds the node and the string; str points
+ * just past the node, so the pair is freed with a single free()
+ *
+ * Return: the new node with next set to NULL, or NULL if it failed
+ */
+static list_t *new_inline_node(const char *str)
+{
+	size_t len = strlen(str);
+	list_t *new = malloc(sizeof(list_t) + len + 1);
+
+	if (!new)
+		return (NULL);
+
+	new->str = (char *)(new + 1);
+	memcpy(new->str, str, len + 1);
+	new->len = len;
+	new->next = NULL;
+
+	return (new);
+}
+
+/**
+ * add_node_inline - adds a single-allocation node at the beginning
+ * @head: double pointer to the list_t list
+ * @str: string to copy into the new node
+ *
+ * Return: the address of the new element, or NULL if it failed
+ */
+list_t *add_node_inline(list_t **head, const char *str)
+{
+	list_t *new = new_inline_node(str);
+
+	if (!new)
+		return (NULL);
+
+	new->next = *head;
+	*head = new;
+
+	return (new);
+}
+
+/**
+ * add_node_end_inline - adds a single-allocation node at the end
+ * @head: double pointer to the list_t list
+ * @str: string to copy into the new node
+ *
+ * Return: address of the new element, or NULL if it failed
+ */
+list_t *add_node_end_inline(list_t **head, const char *str)
+{
+	list_t *new = new_inline_node(str);
+
+	if (!new)
+		return (NULL);
+
+	while (*head)
+		head = &(*head)->next;
+	*head = new;
+
+	return (new);
+}
+
+/**
+ * free_list_inline - frees a list built with the *_inline functions
+ * @head: list_t list to be freed
+ */
+void free_list_inline(list_t *head)
+{
+	list_t *temp;
+
+	while (head)
+	{
+		temp = head->next;
+		free(head);
+		head = temp;
+	}
+}
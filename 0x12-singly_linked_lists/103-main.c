@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "lists.h"
+
+/**
+ * main - check the code
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	list_t *head, *tags;
+	strtab_t tab;
+	char *names[] = {"Anne", "Colton", "Anne", "Betty", "Colton"};
+	int i;
+
+	head = NULL;
+	add_node_inline(&head, "Holden");
+	add_node_end_inline(&head, "Ian");
+	add_node_inline(&head, "");
+	print_list(head);
+	free_list_inline(head);
+
+	tags = NULL;
+	strtab_init(&tab);
+	for (i = 0; i < 1000000; i++)
+		add_node_interned(&tags, &tab, names[i % 5]);
+	add_node_end_interned(&tags, &tab, "Walton");
+	printf("%lu nodes, %lu strings\n", (unsigned long)list_len(tags),
+	       (unsigned long)tab.used);
+	printf("shared: %d\n", tags->str == tags->next->next->next->str);
+	free_list_inline(tags);
+	strtab_free(&tab);
+	return (0);
+}
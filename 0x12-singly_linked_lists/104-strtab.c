@@ -0,0 +1,107 @@
+#include <stdlib.h>
+#include <string.h>
+#include "lists.h"
+
+/**
+ * str_hash - FNV-1a hash of a string
+ * @str: string to hash
+ * @len: length of the string
+ *
+ * Return: the hash
+ */
+static size_t str_hash(const char *str, size_t len)
+{
+	size_t h = (size_t)2166136261UL;
+
+	while (len--)
+		h = (h ^ (unsigned char)*str++) * 16777619UL;
+
+	return (h);
+}
+
+/**
+ * strtab_init - prepares an empty interning table
+ * @tab: table to initialise
+ */
+void strtab_init(strtab_t *tab)
+{
+	tab->slots = NULL;
+	tab->cap = 0;
+	tab->used = 0;
+}
+
+/**
+ * strtab_grow - doubles the number of slots and rehashes
+ * @tab: table to grow
+ *
+ * Return: 1 on success, 0 if allocation failed
+ */
+static int strtab_grow(strtab_t *tab)
+{
+	size_t cap = tab->cap ? tab->cap * 2 : 64, i, j;
+	char **slots = calloc(cap, sizeof(char *));
+
+	if (!slots)
+		return (0);
+
+	for (i = 0; i < tab->cap; i++)
+		if (tab->slots[i])
+		{
+			j = str_hash(tab->slots[i], strlen(tab->slots[i]));
+			while (slots[j & (cap - 1)])
+				j++;
+			slots[j & (cap - 1)] = tab->slots[i];
+		}
+	free(tab->slots);
+	tab->slots = slots;
+	tab->cap = cap;
+
+	return (1);
+}
+
+/**
+ * strtab_intern - returns the single stored copy of a string
+ * @tab: table to look in
+ * @str: string to intern
+ * @len: length of the string
+ *
+ * Description: linear probing, kept at most 3/4 full
+ *
+ * Return: the interned copy, owned by the table, or NULL on failure
+ */
+char *strtab_intern(strtab_t *tab, const char *str, size_t len)
+{
+	size_t j;
+	char *s;
+
+	if (4 * (tab->used + 1) > 3 * tab->cap && !strtab_grow(tab))
+		return (NULL);
+
+	for (j = str_hash(str, len); (s = tab->slots[j & (tab->cap - 1)]); j++)
+		if (strncmp(s, str, len) == 0 && s[len] == '\0')
+			return (s);
+
+	s = malloc(len + 1);
+	if (!s)
+		return (NULL);
+	memcpy(s, str, len);
+	s[len] = '\0';
+	tab->slots[j & (tab->cap - 1)] = s;
+	tab->used++;
+
+	return (s);
+}
+
+/**
+ * strtab_free - frees every interned string and the table
+ * @tab: table to free; it is left empty
+ */
+void strtab_free(strtab_t *tab)
+{
+	size_t i;
+
+	for (i = 0; i < tab->cap; i++)
+		free(tab->slots[i]);
+	free(tab->slots);
+	strtab_init(tab);
+}
@@ -0,0 +1,52 @@
+#include <stdlib.h>
+#include <string.h>
+#include "lists.h"
+
+/**
+ * add_node_interned - adds a node sharing its string through a table
+ * @head: double pointer to the list_t list
+ * @tab: interning table that owns the string storage
+ * @str: string for the new node
+ *
+ * Description: the node's str points into @tab and must not be
+ * changed or freed; free the nodes with free_list_inline(), then
+ * the strings with strtab_free()
+ *
+ * Return: the address of the new element, or NULL if it failed
+ */
+list_t *add_node_interned(list_t **head, strtab_t *tab, const char *str)
+{
+	size_t len = strlen(str);
+	list_t *new = malloc(sizeof(list_t));
+
+	if (!new)
+		return (NULL);
+
+	new->str = strtab_intern(tab, str, len);
+	if (!new->str)
+	{
+		free(new);
+		return (NULL);
+	}
+	new->len = len;
+	new->next = *head;
+	*head = new;
+
+	return (new);
+}
+
+/**
+ * add_node_end_interned - adds an interned node at the end of a list
+ * @head: double pointer to the list_t list
+ * @tab: interning table that owns the string storage
+ * @str: string for the new node
+ *
+ * Return: address of the new element, or NULL if it failed
+ */
+list_t *add_node_end_interned(list_t **head, strtab_t *tab, const char *str)
+{
+	while (*head)
+		head = &(*head)->next;
+
+	return (add_node_interned(head, tab, str));
+}
@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include "lists.h"
+
+/**
+ * list_handle_pop - removes the first node of a list
+ * @h: handle of the list
+ *
+ * Return: the string of the removed node, which the caller must free,
+ * or NULL if the list is empty
+ */
+char *list_handle_pop(list_handle_t *h)
+{
+	list_t *node = h->head;
+	char *str;
+
+	if (!node)
+		return (NULL);
+
+	str = node->str;
+	h->head = node->next;
+	if (!h->head)
+		h->tail = NULL;
+	h->count--;
+	free(node);
+
+	return (str);
+}
+
+/**
+ * list_handle_free - frees every node of a list and empties the handle
+ * @h: handle of the list
+ */
+void list_handle_free(list_handle_t *h)
+{
+	free_list(h->head);
+	list_handle_init(h);
+}
+
+/**
+ * list_handle_len - returns the number of nodes in O(1)
+ * @h: handle to query
+ *
+ * Return: number of nodes in the list
+ */
+size_t list_handle_len(const list_handle_t *h)
+{
+	return (h->count);
+}
@@ -22,6 +22,11 @@ list_t *add_node(list_t **head, const char *str)
 		return (NULL);
 
 	new->str = strdup(str);
+	if (!new->str)
+	{
+		free(new);
+		return (NULL);
+	}
 	new->len = len;
 	new->next = (*head);
 	(*head) = new;
@@ -1,6 +1,8 @@
 #ifndef LISTS_H
 #define LISTS_H
 
+#include <stddef.h>
+
 /**
  * struct list_s - singly linked list
  * @str: string - (malloc'ed string)
@@ -17,10 +19,60 @@ typedef struct list_s
 	struct list_s *next;
 } list_t;
 
+/**
+ * struct list_handle_s - list_t list plus cached tail and length
+ * @head: first node, usable with every list_t ** function
+ * @tail: last node, NULL when the list is empty
+ * @count: number of nodes
+ *
+ * Description: makes appending and counting O(1); call
+ * list_handle_attach() again after changing @head directly
+ */
+typedef struct list_handle_s
+{
+	list_t *head;
+	list_t *tail;
+	size_t count;
+} list_handle_t;
+
+/**
+ * struct strtab_s - string interning table
+ * @slots: open-addressed hash table of interned strings, NULL if empty
+ * @cap: number of slots, a power of two
+ * @used: number of interned strings
+ *
+ * Description: every distinct string is stored once; nodes made by
+ * the *_interned functions point into this storage
+ */
+typedef struct strtab_s
+{
+	char **slots;
+	size_t cap;
+	size_t used;
+} strtab_t;
+
 size_t print_list(const list_t *h);
 size_t list_len(const list_t *h);
 list_t *add_node(list_t **head, const char *str);
 list_t *add_node_end(list_t **head, const char *str);
 void free_list(list_t *head);
 
+void list_handle_init(list_handle_t *h);
+size_t list_handle_attach(list_handle_t *h, list_t *head);
+list_t *list_handle_append(list_handle_t *h, const char *str);
+list_t *list_handle_prepend(list_handle_t *h, const char *str);
+char *list_handle_pop(list_handle_t *h);
+void list_handle_free(list_handle_t *h);
+size_t list_handle_len(const list_handle_t *h);
+
+list_t *add_node_inline(list_t **head, const char *str);
+list_t *add_node_end_inline(list_t **head, const char *str);
+void free_list_inline(list_t *head);
+
+void strtab_init(strtab_t *tab);
+char *strtab_intern(strtab_t *tab, const char *str, size_t len);
+void strtab_free(strtab_t *tab);
+list_t *add_node_interned(list_t **head, strtab_t *tab, const char *str);
+list_t *add_node_end_interned(list_t **head, strtab_t *tab, const char *str);
+
 #endif
@@ -5,36 +5,28 @@
  * free_listint_safe - frees a linked list
  * @h: pointer to the first node in the linked list
  *
+ * Description: listint_brent() counts the distinct nodes, so each is
+ * freed exactly once, in list order, whatever order the allocator
+ * handed out their addresses in; no freed node is ever read.
+ *
  * Return: number of elements in the freed list
  */
 size_t free_listint_safe(listint_t **h)
 {
-	size_t len = 0;
-	int diff;
+	listint_rho_t rho;
+	size_t len, i;
 	listint_t *temp;
 
 	if (!h || !*h)
 		return (0);
 
-	while (*h)
+	len = listint_brent(*h, &rho);
+	for (i = 0; i < len; i++)
 	{
-		diff = *h - (*h)->next;
-		if (diff > 0)
-		{
-			temp = (*h)->next;
-			free(*h);
-			*h = temp;
-			len++;
-		}
-		else
-		{
-			free(*h);
-			*h = NULL;
-			len++;
-			break;
-		}
+		temp = (*h)->next;
+		free(*h);
+		*h = temp;
 	}
-
 	*h = NULL;
 
 	return (len);
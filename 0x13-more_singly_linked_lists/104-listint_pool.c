@@ -0,0 +1,89 @@
+#include "lists.h"
+#include <stdlib.h>
+
+#define POOL_FIRST_SLAB 64
+#define POOL_MAX_SLAB 65536
+
+/**
+ * listint_pool_init - Prepares an empty node pool.
+ * @pool: Pool to initialise.
+ */
+void listint_pool_init(listint_pool_t *pool)
+{
+	pool->slabs = NULL;
+	pool->free = NULL;
+	pool->bump = NULL;
+	pool->bump_end = NULL;
+	pool->slab_nodes = POOL_FIRST_SLAB;
+}
+
+/**
+ * listint_pool_alloc - Takes one node from a pool.
+ * @pool: Pool to allocate from.
+ *
+ * Description: recycled nodes are reused first, then the newest slab
+ * is carved, and only then is a new (twice as large) slab malloc'ed.
+ *
+ * Return: An uninitialised node, or NULL if it failed.
+ */
+listint_t *listint_pool_alloc(listint_pool_t *pool)
+{
+	listint_slab_t *slab;
+	listint_t *node;
+
+	/* Reuse a released node if there is one */
+	if (pool->free != NULL)
+	{
+		node = pool->free;
+		pool->free = node->next;
+		return (node);
+	}
+
+	/* Start a new slab when the current one is used up */
+	if (pool->bump == pool->bump_end)
+	{
+		slab = malloc(sizeof(*slab) + pool->slab_nodes * sizeof(listint_t));
+		if (slab == NULL)
+			return (NULL);
+		slab->count = pool->slab_nodes;
+		slab->next = pool->slabs;
+		pool->slabs = slab;
+		pool->bump = (listint_t *)(slab + 1);
+		pool->bump_end = pool->bump + slab->count;
+		if (pool->slab_nodes < POOL_MAX_SLAB)
+			pool->slab_nodes *= 2;
+	}
+
+	return (pool->bump++);
+}
+
+/**
+ * listint_pool_release - Gives a node back to its pool.
+ * @pool: Pool the node came from.
+ * @node: Node to recycle.
+ */
+void listint_pool_release(listint_pool_t *pool, listint_t *node)
+{
+	node->next = pool->free;
+	pool->free = node;
+}
+
+/**
+ * listint_pool_destroy - Frees every slab of a pool at once.
+ * @pool: Pool to empty; it can be reused afterwards.
+ *
+ * Description: runs in O(slabs), not O(nodes). Every node of every
+ * list built from the pool becomes invalid.
+ */
+void listint_pool_destroy(listint_pool_t *pool)
+{
+	listint_slab_t *next;
+
+	while (pool->slabs != NULL)
+	{
+		next = pool->slabs->next;
+		free(pool->slabs);
+		pool->slabs = next;
+	}
+	listint_pool_init(pool);
+}
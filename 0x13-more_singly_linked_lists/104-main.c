@@ -0,0 +1,30 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "lists.h"
+
+/**
+ * main - check the code
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	listint_pool_t pool;
+	listint_t *head;
+	int i;
+
+	listint_pool_init(&pool);
+	head = NULL;
+	for (i = 0; i < 1000000; i++)
+		add_nodeint_pool(&pool, &head, i);
+	printf("len = %lu\n", (unsigned long)listint_len(head));
+	for (i = 0; i < 999995; i++)
+		pop_listint_pool(&pool, &head);
+	add_nodeint_end_pool(&pool, &head, 98);
+	insert_nodeint_at_index_pool(&pool, &head, 2, 402);
+	delete_nodeint_at_index_pool(&pool, &head, 0);
+	print_listint(head);
+	free_listint_pool(&pool, &head);
+	return (0);
+}
@@ -0,0 +1,99 @@
+#include "lists.h"
+
+/**
+ * add_nodeint_pool - Adds a pooled node at the beginning of a list.
+ * @pool: Pool to take the node from.
+ * @head: Pointer to a pointer to the head of the list.
+ * @n: Value to be stored in the new node.
+ *
+ * Return: The address of the new element, or NULL if it failed.
+ */
+listint_t *add_nodeint_pool(listint_pool_t *pool, listint_t **head,
+			    const int n)
+{
+	listint_t *new_node;
+
+	if (head == NULL)
+		return (NULL);
+
+	new_node = listint_pool_alloc(pool);
+	if (new_node == NULL)
+		return (NULL);
+
+	new_node->n = n;
+	new_node->next = *head;
+	*head = new_node;
+
+	return (new_node);
+}
+
+/**
+ * add_nodeint_end_pool - Adds a pooled node at the end of a list.
+ * @pool: Pool to take the node from.
+ * @head: Pointer to a pointer to the head of the list.
+ * @n: The integer value to store in the new node.
+ *
+ * Return: The address of the new element, or NULL if it failed.
+ */
+listint_t *add_nodeint_end_pool(listint_pool_t *pool, listint_t **head,
+				const int n)
+{
+	listint_t **link = head;
+	listint_t *new_node;
+
+	if (head == NULL)
+		return (NULL);
+
+	new_node = listint_pool_alloc(pool);
+	if (new_node == NULL)
+		return (NULL);
+
+	new_node->n = n;
+	new_node->next = NULL;
+
+	/* Find the NULL link at the end of the list and hook the node in */
+	while (*link != NULL)
+		link = &(*link)->next;
+	*link = new_node;
+
+	return (new_node);
+}
+
+/**
+ * insert_nodeint_at_index_pool - Inserts a pooled node at a position.
+ * @pool: Pool to take the node from.
+ * @head: Pointer to a pointer to the head of the list.
+ * @idx: Index where the new node should be added, starting at 0.
+ * @n: Integer value to store in the new node.
+ *
+ * Return: The address of the new node, or NULL if it failed.
+ */
+listint_t *insert_nodeint_at_index_pool(listint_pool_t *pool,
+					listint_t **head, unsigned int idx,
+					int n)
+{
+	listint_t **link = head;
+	listint_t *new_node;
+
+	if (head == NULL)
+		return (NULL);
+
+	/* Walk to the link that must point at the new node */
+	while (idx > 0 && *link != NULL)
+	{
+		link = &(*link)->next;
+		idx--;
+	}
+	if (idx > 0)
+		return (NULL);
+
+	new_node = listint_pool_alloc(pool);
+	if (new_node == NULL)
+		return (NULL);
+
+	new_node->n = n;
+	new_node->next = *link;
+	*link = new_node;
+
+	return (new_node);
+}
@@ -0,0 +1,75 @@
+#include "lists.h"
+
+/**
+ * pop_listint_pool - Deletes the head node of a pooled list
+ *                    and returns the head node's data (n).
+ * @pool: Pool the list was built from.
+ * @head: Pointer to a pointer to the head of the list.
+ *
+ * Return: The data (n) of the head node, or 0 if the list is empty.
+ */
+int pop_listint_pool(listint_pool_t *pool, listint_t **head)
+{
+	listint_t *temp;
+	int data;
+
+	if (head == NULL || *head == NULL)
+		return (0);
+
+	temp = *head;
+	data = temp->n;
+	*head = temp->next;
+
+	/* The node goes back to the pool instead of to free() */
+	listint_pool_release(pool, temp);
+
+	return (data);
+}
+
+/**
+ * delete_nodeint_at_index_pool - Deletes the node at a given position.
+ * @pool: Pool the list was built from.
+ * @head: Pointer to a pointer to the head of the list.
+ * @index: Index of the node to be deleted, starting at 0.
+ *
+ * Return: 1 if it succeeded, -1 if it failed.
+ */
+int delete_nodeint_at_index_pool(listint_pool_t *pool, listint_t **head,
+				 unsigned int index)
+{
+	listint_t **link = head;
+	listint_t *temp;
+
+	if (head == NULL)
+		return (-1);
+
+	/* Walk to the link that points at the doomed node */
+	while (index > 0 && *link != NULL)
+	{
+		link = &(*link)->next;
+		index--;
+	}
+	if (*link == NULL)
+		return (-1);
+
+	temp = *link;
+	*link = temp->next;
+	listint_pool_release(pool, temp);
+
+	return (1);
+}
+
+/**
+ * free_listint_pool - Frees a pooled list and sets the head to NULL.
+ * @pool: Pool the list was built from; it is emptied.
+ * @head: Pointer to a pointer to the head of the list.
+ *
+ * Description: the nodes are not visited; the pool drops its slabs,
+ * so the cost is O(slabs) whatever the length of the list.
+ */
+void free_listint_pool(listint_pool_t *pool, listint_t **head)
+{
+	listint_pool_destroy(pool);
+	if (head != NULL)
+		*head = NULL;
+}
@@ -0,0 +1,62 @@
+#include "lists.h"
+
+/**
+ * listint_handle_init - Prepares an empty list handle.
+ * @h: Handle to initialise.
+ */
+void listint_handle_init(listint_handle_t *h)
+{
+	h->head = NULL;
+	h->tail = NULL;
+	h->count = 0;
+}
+
+/**
+ * listint_handle_attach - Wraps an existing raw list in a handle.
+ * @h: Handle that takes over the list.
+ * @head: Head of a NULL-terminated listint_t list, or NULL.
+ *
+ * Description: walks the list once to find its tail and length;
+ * every operation on the handle is O(1) from then on.
+ *
+ * Return: The number of nodes in the list.
+ */
+size_t listint_handle_attach(listint_handle_t *h, listint_t *head)
+{
+	listint_handle_init(h);
+	h->head = head;
+	while (head != NULL)
+	{
+		h->tail = head;
+		h->count++;
+		head = head->next;
+	}
+
+	return (h->count);
+}
+
+/**
+ * listint_handle_detach - Hands the list back to the raw API.
+ * @h: Handle to empty.
+ *
+ * Return: The head of the list, now owned by the caller.
+ */
+listint_t *listint_handle_detach(listint_handle_t *h)
+{
+	listint_t *head = h->head;
+
+	listint_handle_init(h);
+
+	return (head);
+}
+
+/**
+ * listint_handle_len - Returns the number of nodes in O(1).
+ * @h: Handle to query.
+ *
+ * Return: The number of nodes in the list.
+ */
+size_t listint_handle_len(const listint_handle_t *h)
+{
+	return (h->count);
+}
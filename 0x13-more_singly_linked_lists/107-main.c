@@ -0,0 +1,34 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "lists.h"
+
+/**
+ * main - check the code
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	listint_handle_t h;
+	listint_t *head;
+	int i;
+
+	listint_handle_init(&h);
+	for (i = 0; i < 1000000; i++)
+		listint_handle_append(&h, i);
+	printf("len = %lu\n", (unsigned long)listint_handle_len(&h));
+	while (listint_handle_len(&h) > 3)
+		listint_handle_pop(&h);
+	listint_handle_prepend(&h, 402);
+	print_listint(h.head);
+	printf("-----------------\n");
+	head = listint_handle_detach(&h);
+	add_nodeint(&head, 98);
+	listint_handle_attach(&h, head);
+	listint_handle_append(&h, 1024);
+	printf("len = %lu\n", (unsigned long)listint_handle_len(&h));
+	print_listint(h.head);
+	listint_handle_free(&h);
+	return (0);
+}
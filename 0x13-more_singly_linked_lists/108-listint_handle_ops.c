@@ -0,0 +1,95 @@
+#include "lists.h"
+#include <stdlib.h>
+
+/**
+ * listint_handle_append - Adds a new node at the end of a list in O(1).
+ * @h: Handle of the list.
+ * @n: The integer value to store in the new node.
+ *
+ * Return: The address of the new element, or NULL if it failed.
+ */
+listint_t *listint_handle_append(listint_handle_t *h, const int n)
+{
+	listint_t *new_node = malloc(sizeof(listint_t));
+
+	if (new_node == NULL)
+		return (NULL);
+
+	new_node->n = n;
+	new_node->next = NULL;
+
+	/* Link after the cached tail instead of walking the list */
+	if (h->tail == NULL)
+		h->head = new_node;
+	else
+		h->tail->next = new_node;
+	h->tail = new_node;
+	h->count++;
+
+	return (new_node);
+}
+
+/**
+ * listint_handle_prepend - Adds a new node at the beginning of a list.
+ * @h: Handle of the list.
+ * @n: The integer value to store in the new node.
+ *
+ * Return: The address of the new element, or NULL if it failed.
+ */
+listint_t *listint_handle_prepend(listint_handle_t *h, const int n)
+{
+	listint_t *new_node = malloc(sizeof(listint_t));
+
+	if (new_node == NULL)
+		return (NULL);
+
+	new_node->n = n;
+	new_node->next = h->head;
+	h->head = new_node;
+	if (h->tail == NULL)
+		h->tail = new_node;
+	h->count++;
+
+	return (new_node);
+}
+
+/**
+ * listint_handle_pop - Deletes the head node and returns its data (n).
+ * @h: Handle of the list.
+ *
+ * Return: The data (n) of the head node, or 0 if the list is empty.
+ */
+int listint_handle_pop(listint_handle_t *h)
+{
+	listint_t *temp = h->head;
+	int data;
+
+	if (temp == NULL)
+		return (0);
+
+	data = temp->n;
+	h->head = temp->next;
+	if (h->head == NULL)
+		h->tail = NULL;
+	h->count--;
+	free(temp);
+
+	return (data);
+}
+
+/**
+ * listint_handle_free - Frees every node and leaves the handle empty.
+ * @h: Handle of the list.
+ */
+void listint_handle_free(listint_handle_t *h)
+{
+	listint_t *temp;
+
+	while (h->head != NULL)
+	{
+		temp = h->head->next;
+		free(h->head);
+		h->head = temp;
+	}
+	listint_handle_init(h);
+}
@@ -0,0 +1,31 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "lists.h"
+
+/**
+ * main - check the code
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	ulist_t l;
+	int i;
+
+	ulist_init(&l);
+	for (i = 0; i < 100; i++)
+		ulist_add_end(&l, i);
+	printf("sum = %ld\n", ulist_sum(&l));
+	while (l.count > 4)
+		ulist_pop(&l);
+	ulist_add(&l, 98);
+	ulist_insert_at_index(&l, 2, 402);
+	ulist_delete_at_index(&l, 5);
+	ulist_reverse(&l);
+	ulist_print(&l);
+	printf("-----------------\n");
+	printf("[2] = %d\n", *ulist_get_at_index(&l, 2));
+	ulist_free(&l);
+	return (0);
+}
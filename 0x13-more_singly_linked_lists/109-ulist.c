@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "lists.h"
+
+/**
+ * ulist_init - Prepares an empty unrolled list.
+ * @l: List to initialise.
+ */
+void ulist_init(ulist_t *l)
+{
+	l->head = NULL;
+	l->tail = NULL;
+	l->count = 0;
+}
+
+/**
+ * ulist_free - Frees every node of an unrolled list and empties it.
+ * @l: List to free.
+ */
+void ulist_free(ulist_t *l)
+{
+	ulist_node_t *temp;
+
+	while (l->head != NULL)
+	{
+		temp = l->head->next;
+		free(l->head);
+		l->head = temp;
+	}
+	ulist_init(l);
+}
+
+/**
+ * ulist_print - Prints all the values of an unrolled list, one per line.
+ * @l: List to print.
+ *
+ * Return: The number of values printed.
+ */
+size_t ulist_print(const ulist_t *l)
+{
+	const ulist_node_t *node;
+	unsigned int i;
+
+	for (node = l->head; node != NULL; node = node->next)
+		for (i = 0; i < node->count; i++)
+			printf("%d\n", node->n[i]);
+
+	return (l->count);
+}
+
+/**
+ * ulist_get_at_index - Finds the value at a given position.
+ * @l: List to search.
+ * @index: Index of the value, starting at 0.
+ *
+ * Description: skips whole nodes, so it costs one cache miss per
+ * ULIST_CAP values instead of one per value.
+ *
+ * Return: A pointer to the value, or NULL if it does not exist.
+ */
+int *ulist_get_at_index(const ulist_t *l, size_t index)
+{
+	ulist_node_t *node = l->head;
+
+	if (index >= l->count)
+		return (NULL);
+
+	/* Skip whole nodes until the index falls inside one */
+	while (index >= node->count)
+	{
+		index -= node->count;
+		node = node->next;
+	}
+
+	return (&node->n[index]);
+}
@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include <string.h>
+#include "lists.h"
+
+/**
+ * ulist_node_after - Links a new, zeroed node after another one.
+ * @l: List that owns the nodes.
+ * @prev: Node to link after, or NULL to start an empty list.
+ *
+ * Return: The new node, or NULL if it failed.
+ */
+static ulist_node_t *ulist_node_after(ulist_t *l, ulist_node_t *prev)
+{
+	ulist_node_t *node = calloc(1, sizeof(ulist_node_t));
+
+	if (node == NULL)
+		return (NULL);
+
+	if (prev == NULL)
+		l->head = node;
+	else
+	{
+		node->next = prev->next;
+		prev->next = node;
+	}
+	if (l->tail == prev)
+		l->tail = node;
+
+	return (node);
+}
+
+/**
+ * ulist_make_room - Makes sure a slot is free at a position in a node.
+ * @l: List that owns the node.
+ * @node: Pointer to the node; may be moved to the new node on a split.
+ * @off: Pointer to the offset in the node; adjusted with @node.
+ *
+ * Description: a full node is split in half, except when appending to
+ * the tail, where a fresh node keeps sequential builds fully packed.
+ *
+ * Return: 1 on success, 0 if a new node could not be allocated.
+ */
+static int ulist_make_room(ulist_t *l, ulist_node_t **node, unsigned int *off)
+{
+	ulist_node_t *full = *node, *fresh;
+	unsigned int half = ULIST_CAP / 2;
+
+	if (full->count < ULIST_CAP)
+		return (1);
+
+	fresh = ulist_node_after(l, full);
+	if (fresh == NULL)
+		return (0);
+
+	/* Only an append can ask for the slot past a full node */
+	if (*off == ULIST_CAP)
+	{
+		*node = fresh;
+		*off = 0;
+		return (1);
+	}
+
+	/* Move the upper half into the new node and zero the old slots */
+	memcpy(fresh->n, full->n + half, (ULIST_CAP - half) * sizeof(int));
+	memset(full->n + half, 0, (ULIST_CAP - half) * sizeof(int));
+	fresh->count = ULIST_CAP - half;
+	full->count = half;
+	if (*off > half)
+	{
+		*node = fresh;
+		*off -= half;
+	}
+
+	return (1);
+}
+
+/**
+ * ulist_insert_at_index - Inserts a value at a given position.
+ * @l: List to insert into.
+ * @idx: Index where the value should be added, starting at 0.
+ * @n: Value to insert.
+ *
+ * Return: A pointer to the stored value, or NULL if it failed.
+ */
+int *ulist_insert_at_index(ulist_t *l, size_t idx, int n)
+{
+	ulist_node_t *node = l->head;
+	unsigned int off;
+
+	if (idx > l->count)
+		return (NULL);
+
+	if (node == NULL)
+		node = ulist_node_after(l, NULL);
+	else if (idx == l->count)
+	{
+		/* Appending: go straight to the tail */
+		node = l->tail;
+		idx = node->count;
+	}
+	else
+		while (idx >= node->count)
+		{
+			idx -= node->count;
+			node = node->next;
+		}
+	off = idx;
+	if (node == NULL || !ulist_make_room(l, &node, &off))
+		return (NULL);
+
+	memmove(node->n + off + 1, node->n + off,
+		(node->count - off) * sizeof(int));
+	node->n[off] = n;
+	node->count++;
+	l->count++;
+
+	return (&node->n[off]);
+}
+
+/**
+ * ulist_add - Adds a value at the beginning of an unrolled list.
+ * @l: List to add to.
+ * @n: Value to add.
+ *
+ * Return: A pointer to the stored value, or NULL if it failed.
+ */
+int *ulist_add(ulist_t *l, int n)
+{
+	return (ulist_insert_at_index(l, 0, n));
+}
+
+/**
+ * ulist_add_end - Adds a value at the end of an unrolled list in O(1).
+ * @l: List to add to.
+ * @n: Value to add.
+ *
+ * Return: A pointer to the stored value, or NULL if it failed.
+ */
+int *ulist_add_end(ulist_t *l, int n)
+{
+	return (ulist_insert_at_index(l, l->count, n));
+}
@@ -0,0 +1,91 @@
+#include <stdlib.h>
+#include <string.h>
+#include "lists.h"
+
+/**
+ * ulist_remove - Removes one value from a node and rebalances.
+ * @l: List that owns the node.
+ * @prev: Node before @node, or NULL if @node is the head.
+ * @node: Node holding the value.
+ * @off: Offset of the value in @node.
+ *
+ * Description: an emptied node is unlinked, and a node that fits in
+ * half a node together with its successor absorbs it, so the list
+ * never degrades into one value per node.
+ */
+static void ulist_remove(ulist_t *l, ulist_node_t *prev, ulist_node_t *node,
+			 unsigned int off)
+{
+	ulist_node_t *next = node->next;
+
+	memmove(node->n + off, node->n + off + 1,
+		(node->count - off - 1) * sizeof(int));
+	node->n[--node->count] = 0;
+	l->count--;
+
+	if (node->count == 0)
+	{
+		/* Unlink the empty node */
+		if (prev == NULL)
+			l->head = next;
+		else
+			prev->next = next;
+		if (l->tail == node)
+			l->tail = prev;
+		free(node);
+	}
+	else if (next != NULL && node->count + next->count <= ULIST_CAP / 2)
+	{
+		/* Merge the successor into this node */
+		memcpy(node->n + node->count, next->n, next->count * sizeof(int));
+		node->count += next->count;
+		node->next = next->next;
+		if (l->tail == next)
+			l->tail = node;
+		free(next);
+	}
+}
+
+/**
+ * ulist_delete_at_index - Deletes the value at a given position.
+ * @l: List to delete from.
+ * @index: Index of the value to be deleted, starting at 0.
+ *
+ * Return: 1 if it succeeded, -1 if it failed.
+ */
+int ulist_delete_at_index(ulist_t *l, size_t index)
+{
+	ulist_node_t *prev = NULL, *node = l->head;
+
+	if (index >= l->count)
+		return (-1);
+
+	while (index >= node->count)
+	{
+		index -= node->count;
+		prev = node;
+		node = node->next;
+	}
+	ulist_remove(l, prev, node, index);
+
+	return (1);
+}
+
+/**
+ * ulist_pop - Deletes the first value and returns it.
+ * @l: List to pop from.
+ *
+ * Return: The first value, or 0 if the list is empty.
+ */
+int ulist_pop(ulist_t *l)
+{
+	int data;
+
+	if (l->head == NULL)
+		return (0);
+
+	data = l->head->n[0];
+	ulist_remove(l, NULL, l->head, 0);
+
+	return (data);
+}
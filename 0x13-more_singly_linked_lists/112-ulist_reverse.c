@@ -0,0 +1,54 @@
+#include "lists.h"
+
+/**
+ * ulist_reverse - Reverses an unrolled list in place.
+ * @l: List to reverse.
+ *
+ * Description: reverses the chain of nodes, then the used part of
+ * each node's array, so the zeroed slots stay at the end.
+ */
+void ulist_reverse(ulist_t *l)
+{
+	ulist_node_t *prev = NULL, *next, *node = l->head;
+	unsigned int i, j;
+	int tmp;
+
+	l->tail = node;
+	while (node != NULL)
+	{
+		for (i = 0, j = node->count - 1; i < j; i++, j--)
+		{
+			tmp = node->n[i];
+			node->n[i] = node->n[j];
+			node->n[j] = tmp;
+		}
+		next = node->next;
+		node->next = prev;
+		prev = node;
+		node = next;
+	}
+	l->head = prev;
+}
+
+/**
+ * ulist_sum - Returns the sum of all the values of an unrolled list.
+ * @l: List to sum.
+ *
+ * Description: every node is summed over all ULIST_CAP slots, the
+ * unused ones being zero, so the inner loop has a constant trip
+ * count and no branch; at -O2/-O3 it compiles to vector adds.
+ *
+ * Return: The sum, as a long so that large lists do not overflow.
+ */
+long ulist_sum(const ulist_t *l)
+{
+	const ulist_node_t *node;
+	long sum = 0;
+	int i;
+
+	for (node = l->head; node != NULL; node = node->next)
+		for (i = 0; i < ULIST_CAP; i++)
+			sum += node->n[i];
+
+	return (sum);
+}
@@ -0,0 +1,124 @@
+#include "lists.h"
+
+/**
+ * listint_stats - Computes sum, min, max and count in one pass.
+ * @h: Pointer to the head of the list.
+ * @st: Where to store the aggregates.
+ *
+ * Description: a second pointer runs LISTINT_LOOKAHEAD nodes ahead and
+ * prefetches, so the misses of the next nodes overlap with the
+ * work on the current one.
+ *
+ * Return: The number of nodes.
+ */
+size_t listint_stats(const listint_t *h, listint_stats_t *st)
+{
+	const listint_t *ahead = h;
+	int i;
+
+	st->sum = 0;
+	st->count = 0;
+	st->min = h != NULL ? h->n : 0;
+	st->max = st->min;
+	for (i = 0; i < LISTINT_LOOKAHEAD && ahead != NULL; i++)
+		ahead = ahead->next;
+
+	for (; h != NULL; h = h->next)
+	{
+		if (ahead != NULL)
+		{
+			LISTINT_PREFETCH(ahead->next);
+			ahead = ahead->next;
+		}
+		st->sum += h->n;
+		st->min = h->n < st->min ? h->n : st->min;
+		st->max = h->n > st->max ? h->n : st->max;
+		st->count++;
+	}
+
+	return (st->count);
+}
+
+/**
+ * listint_sum64 - Returns the sum of a list without overflowing.
+ * @h: Pointer to the head of the list.
+ *
+ * Return: The sum of all the data, or 0 if the list is empty.
+ */
+long listint_sum64(const listint_t *h)
+{
+	listint_stats_t st;
+
+	listint_stats(h, &st);
+
+	return (st.sum);
+}
+
+/**
+ * listint_minmax - Finds the smallest and largest values of a list.
+ * @h: Pointer to the head of the list.
+ * @min: Where to store the smallest value, or NULL.
+ * @max: Where to store the largest value, or NULL.
+ *
+ * Return: 1 if it succeeded, -1 if the list is empty.
+ */
+int listint_minmax(const listint_t *h, int *min, int *max)
+{
+	listint_stats_t st;
+
+	if (listint_stats(h, &st) == 0)
+		return (-1);
+	if (min != NULL)
+		*min = st.min;
+	if (max != NULL)
+		*max = st.max;
+
+	return (1);
+}
+
+/**
+ * listint_count_if - Counts the nodes whose value matches a predicate.
+ * @h: Pointer to the head of the list.
+ * @pred: Returns non-zero for the values to count.
+ * @arg: Passed through to @pred.
+ *
+ * Return: The number of matching nodes.
+ */
+size_t listint_count_if(const listint_t *h, int (*pred)(int n, void *arg),
+			void *arg)
+{
+	const listint_t *ahead = h;
+	size_t count = 0;
+	int i;
+
+	for (i = 0; i < LISTINT_LOOKAHEAD && ahead != NULL; i++)
+		ahead = ahead->next;
+
+	for (; h != NULL; h = h->next)
+	{
+		if (ahead != NULL)
+		{
+			LISTINT_PREFETCH(ahead->next);
+			ahead = ahead->next;
+		}
+		count += pred(h->n, arg) != 0;
+	}
+
+	return (count);
+}
+
+/**
+ * listint_mean - Returns the average value of a list.
+ * @h: Pointer to the head of the list.
+ *
+ * Return: The mean, or 0.0 if the list is empty.
+ */
+double listint_mean(const listint_t *h)
+{
+	listint_stats_t st;
+
+	if (listint_stats(h, &st) == 0)
+		return (0.0);
+
+	return ((double)st.sum / st.count);
+}
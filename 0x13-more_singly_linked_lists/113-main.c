@@ -0,0 +1,44 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "lists.h"
+
+/**
+ * is_big - predicate for listint_count_if
+ * @n: value to test
+ * @arg: pointer to the threshold
+ *
+ * Return: 1 if n is above the threshold, 0 otherwise
+ */
+int is_big(int n, void *arg)
+{
+	return (n > *(int *)arg);
+}
+
+/**
+ * main - check the code
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	listint_pool_t pool;
+	listint_stats_t st;
+	listint_t *head;
+	int i, threshold = 100;
+
+	listint_pool_init(&pool);
+	head = NULL;
+	for (i = 0; i < 5000000; i++)
+		add_nodeint_pool(&pool, &head, 1000 - i % 2000);
+	add_nodeint_pool(&pool, &head, 2147483647);
+	listint_pool_stats(&pool, head, &st);
+	printf("sum = %ld, min = %d, max = %d, count = %lu\n",
+	       st.sum, st.min, st.max, (unsigned long)st.count);
+	printf("sum64 = %ld\n", listint_sum64(head));
+	printf("mean = %f\n", listint_mean(head));
+	printf("big = %lu\n",
+	       (unsigned long)listint_count_if(head, is_big, &threshold));
+	free_listint_pool(&pool, &head);
+	return (0);
+}
@@ -0,0 +1,71 @@
+#include "lists.h"
+
+/**
+ * stats_span - Folds a run of contiguous nodes into the aggregates.
+ * @p: First node of the run.
+ * @n: Number of nodes in the run.
+ * @st: Aggregates to update; min and max must already be seeded.
+ *
+ * Description: the loop has no pointer chasing and no branches, so
+ * the compiler vectorizes it over the node array.
+ */
+static void stats_span(const listint_t *p, size_t n, listint_stats_t *st)
+{
+	long sum = 0;
+	int mn = st->min, mx = st->max;
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		sum += p[i].n;
+		mn = p[i].n < mn ? p[i].n : mn;
+		mx = p[i].n > mx ? p[i].n : mx;
+	}
+	st->sum += sum;
+	st->min = mn;
+	st->max = mx;
+	st->count += n;
+}
+
+/**
+ * listint_pool_stats - Aggregates a list that owns its whole pool.
+ * @pool: Pool the list was built from, shared with no other list.
+ * @head: Head of the list.
+ * @st: Where to store the aggregates.
+ *
+ * Description: while no node has been released, every node the pool
+ * handed out is live, so the slabs are scanned as flat arrays instead
+ * of walking the list. Otherwise this falls back to listint_stats().
+ * The scan cannot tell which list a node belongs to: if the pool also
+ * holds other lists (e.g. it was passed to listint_from_array() or
+ * reverse_listint_copy() more than once, or holds both a list and its
+ * reversed copy), their nodes are counted too and the result is
+ * wrong. Use listint_stats() on such lists.
+ *
+ * Return: The number of nodes.
+ */
+size_t listint_pool_stats(const listint_pool_t *pool, const listint_t *head,
+			  listint_stats_t *st)
+{
+	const listint_slab_t *slab = pool->slabs;
+	const listint_t *first;
+
+	if (pool->free != NULL || head == NULL)
+		return (listint_stats(head, st));
+
+	st->sum = 0;
+	st->count = 0;
+	st->min = head->n;
+	st->max = head->n;
+	for (; slab != NULL; slab = slab->next)
+	{
+		first = (const listint_t *)(slab + 1);
+		/* Only the newest slab is partly used, up to the bump pointer */
+		if (slab == pool->slabs)
+			stats_span(first, pool->bump - first, st);
+		else
+			stats_span(first, slab->count, st);
+	}
+
+	return (st->count);
+}
@@ -0,0 +1,136 @@
+#include "lists.h"
+#include <stdlib.h>
+
+/**
+ * listint_index_init - Prepares an empty indexed list.
+ * @ix: Indexed list to initialise.
+ */
+void listint_index_init(listint_index_t *ix)
+{
+	int l;
+
+	ix->head = NULL;
+	ix->count = 0;
+	ix->levels = 0;
+	ix->seed = 0x9e3779b97f4a7c15UL;
+	for (l = 0; l < LISTINT_SKIP_LEVELS; l++)
+	{
+		ix->top[l].next = NULL;
+		ix->top[l].width = 1;
+	}
+}
+
+/**
+ * listint_skip_tower - Picks a height and allocates a tower for a node.
+ * @ix: Indexed list the node belongs to.
+ * @node: Node to index.
+ * @tower: Where to store the tower; NULL when the height is 0.
+ *
+ * Description: each extra level is kept with probability 1/4,
+ * drawn from a xorshift generator seeded in the list itself.
+ *
+ * Return: The height of the tower, or -1 if allocation failed.
+ */
+int listint_skip_tower(listint_index_t *ix, listint_t *node,
+		       listint_skip_t **tower)
+{
+	unsigned long r;
+	int h = 0;
+
+	ix->seed ^= ix->seed << 13;
+	ix->seed ^= ix->seed >> 7;
+	ix->seed ^= ix->seed << 17;
+	for (r = ix->seed; h < LISTINT_SKIP_LEVELS && (r & 3) == 0; r >>= 2)
+		h++;
+
+	*tower = NULL;
+	if (h == 0)
+		return (0);
+	*tower = malloc(sizeof(listint_skip_t) + (h - 1) * sizeof(listint_link_t));
+	if (*tower == NULL)
+		return (-1);
+	(*tower)->node = node;
+	(*tower)->height = h;
+
+	return (h);
+}
+
+/**
+ * listint_index_build - Indexes an existing list in one pass.
+ * @ix: Empty indexed list that takes over the list.
+ * @head: Head of a NULL-terminated listint_t list, or NULL.
+ *
+ * Return: 1 if it succeeded, -1 if it failed (@ix is left empty).
+ */
+int listint_index_build(listint_index_t *ix, listint_t *head)
+{
+	listint_link_t *last[LISTINT_SKIP_LEVELS];
+	size_t last_rank[LISTINT_SKIP_LEVELS];
+	listint_skip_t *t;
+	int l, h;
+
+	for (l = 0; l < LISTINT_SKIP_LEVELS; l++)
+		last[l] = ix->top, last_rank[l] = 0;
+	for (ix->head = head; head != NULL; head = head->next)
+	{
+		ix->count++;
+		h = listint_skip_tower(ix, head, &t);
+		if (h < 0)
+		{
+			last[0][0].next = NULL;
+			listint_index_clear(ix);
+			return (-1);
+		}
+		/* Hook the tower after the last tower of each of its levels */
+		for (l = 0; l < h; l++)
+		{
+			last[l][l].next = t;
+			last[l][l].width = ix->count - last_rank[l];
+			last[l] = t->link, last_rank[l] = ix->count;
+		}
+		ix->levels = h > ix->levels ? h : ix->levels;
+	}
+	for (l = 0; l < LISTINT_SKIP_LEVELS; l++)
+		last[l][l].next = NULL, last[l][l].width = ix->count + 1 - last_rank[l];
+
+	return (1);
+}
+
+/**
+ * listint_index_clear - Drops the index and hands the list back.
+ * @ix: Indexed list to empty.
+ *
+ * Return: The head of the plain list, now owned by the caller.
+ */
+listint_t *listint_index_clear(listint_index_t *ix)
+{
+	listint_skip_t *t = ix->top[0].next, *next;
+	listint_t *head = ix->head;
+
+	/* Every tower has a level 1 link, so that chain reaches them all */
+	while (t != NULL)
+	{
+		next = t->link[0].next;
+		free(t);
+		t = next;
+	}
+	listint_index_init(ix);
+
+	return (head);
+}
+
+/**
+ * listint_index_free - Frees every node and tower of an indexed list.
+ * @ix: Indexed list to free; it is left empty.
+ */
+void listint_index_free(listint_index_t *ix)
+{
+	listint_t *head = listint_index_clear(ix), *temp;
+
+	while (head != NULL)
+	{
+		temp = head->next;
+		free(head);
+		head = temp;
+	}
+}
@@ -0,0 +1,31 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "lists.h"
+
+/**
+ * main - check the code
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	listint_index_t ix;
+	listint_t *head;
+	unsigned int i;
+
+	head = NULL;
+	for (i = 0; i < 8; i++)
+		add_nodeint(&head, i);
+	listint_index_init(&ix);
+	listint_index_build(&ix, head);
+	for (i = 0; i < 100000; i++)
+		insert_nodeint_at_index_ix(&ix, ix.count / 2, 1000);
+	while (ix.count > 10)
+		delete_nodeint_at_index_ix(&ix, 4);
+	insert_nodeint_at_index_ix(&ix, 3, 98);
+	printf("[5] = %d\n", get_nodeint_at_index_ix(&ix, 5)->n);
+	print_listint(ix.head);
+	listint_index_free(&ix);
+	return (0);
+}
@@ -0,0 +1,153 @@
+#include "lists.h"
+#include <stdlib.h>
+
+/**
+ * skip_find - Finds the node just before a rank.
+ * @ix: Indexed list to search.
+ * @r: Rank to look for; the first node has rank 1.
+ * @upd: If not NULL, receives per level the links of the last tower
+ *       (or the header) that comes before rank @r.
+ * @urank: Receives the ranks of the towers stored in @upd.
+ *
+ * Return: The node of rank @r - 1, or NULL if @r is 1.
+ */
+static listint_t *skip_find(listint_index_t *ix, size_t r,
+			    listint_link_t **upd, size_t *urank)
+{
+	listint_link_t *links = ix->top;
+	listint_t *node = NULL;
+	size_t rank = 0;
+	int l;
+
+	/* Descend the index, moving right while the target stays ahead */
+	for (l = ix->levels - 1; l >= 0; l--)
+	{
+		while (links[l].next != NULL && rank + links[l].width < r)
+		{
+			rank += links[l].width;
+			node = links[l].next->node;
+			links = links[l].next->link;
+		}
+		if (upd != NULL)
+			upd[l] = links, urank[l] = rank;
+	}
+
+	/* Finish on the plain list: a few steps on average */
+	if (rank == 0 && r > 1)
+		node = ix->head, rank = 1;
+	for (; rank + 1 < r; rank++)
+		node = node->next;
+
+	return (node);
+}
+
+/**
+ * get_nodeint_at_index_ix - Returns the nth node of an indexed list.
+ * @ix: Indexed list to search.
+ * @index: Index of the node, starting at 0.
+ *
+ * Return: The node at the index, or NULL if it does not exist.
+ */
+listint_t *get_nodeint_at_index_ix(listint_index_t *ix, unsigned int index)
+{
+	if (index >= ix->count)
+		return (NULL);
+
+	return (skip_find(ix, (size_t)index + 2, NULL, NULL));
+}
+
+/**
+ * insert_nodeint_at_index_ix - Inserts a new node at a given position.
+ * @ix: Indexed list to insert into.
+ * @idx: Index where the new node should be added, starting at 0.
+ * @n: Integer value to store in the new node.
+ *
+ * Return: The address of the new node, or NULL if it failed.
+ */
+listint_t *insert_nodeint_at_index_ix(listint_index_t *ix, unsigned int idx,
+				      int n)
+{
+	listint_link_t *upd[LISTINT_SKIP_LEVELS];
+	size_t urank[LISTINT_SKIP_LEVELS], r = (size_t)idx + 1;
+	listint_t *prev, *new_node;
+	listint_skip_t *t;
+	int l, h;
+
+	if (idx > ix->count)
+		return (NULL);
+	new_node = malloc(sizeof(listint_t));
+	h = new_node == NULL ? -1 : listint_skip_tower(ix, new_node, &t);
+	if (h < 0)
+	{
+		free(new_node);
+		return (NULL);
+	}
+	prev = skip_find(ix, r, upd, urank);
+	new_node->n = n;
+	new_node->next = prev == NULL ? ix->head : prev->next;
+	*(prev == NULL ? &ix->head : &prev->next) = new_node;
+
+	for (; ix->levels < h; ix->levels++)
+	{
+		/* A new level starts as one header link spanning the list */
+		ix->top[ix->levels].next = NULL;
+		ix->top[ix->levels].width = ix->count + 1;
+		upd[ix->levels] = ix->top, urank[ix->levels] = 0;
+	}
+	for (l = 0; l < ix->levels; l++)
+		if (l < h)
+		{
+			t->link[l].next = upd[l][l].next;
+			t->link[l].width = urank[l] + upd[l][l].width + 1 - r;
+			upd[l][l].next = t;
+			upd[l][l].width = r - urank[l];
+		}
+		else
+			upd[l][l].width++;
+	ix->count++;
+
+	return (new_node);
+}
+
+/**
+ * delete_nodeint_at_index_ix - Deletes the node at a given position.
+ * @ix: Indexed list to delete from.
+ * @index: Index of the node to be deleted, starting at 0.
+ *
+ * Return: 1 if it succeeded, -1 if it failed.
+ */
+int delete_nodeint_at_index_ix(listint_index_t *ix, unsigned int index)
+{
+	listint_link_t *upd[LISTINT_SKIP_LEVELS];
+	size_t urank[LISTINT_SKIP_LEVELS];
+	listint_t *prev, *victim;
+	listint_skip_t *t, *tower = NULL;
+	int l;
+
+	if (index >= ix->count)
+		return (-1);
+	prev = skip_find(ix, (size_t)index + 1, upd, urank);
+	victim = prev == NULL ? ix->head : prev->next;
+	*(prev == NULL ? &ix->head : &prev->next) = victim->next;
+
+	for (l = 0; l < ix->levels; l++)
+	{
+		t = upd[l][l].next;
+		if (t != NULL && t->node == victim)
+		{
+			/* Bridge over the victim's tower on this level */
+			upd[l][l].width += t->link[l].width - 1;
+			upd[l][l].next = t->link[l].next;
+			tower = t;
+		}
+		else
+			upd[l][l].width--;
+	}
+	while (ix->levels > 0 && ix->top[ix->levels - 1].next == NULL)
+		ix->levels--;
+	ix->count--;
+	free(tower);
+	free(victim);
+
+	return (1);
+}
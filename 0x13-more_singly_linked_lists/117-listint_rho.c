@@ -0,0 +1,16 @@
+#include "lists.h"
+
+/**
+ * listint_rho - Measures the tail and loop of a listint_t list.
+ * @head: Pointer to the head of the list.
+ * @rho: Where to store the shape of the list.
+ *
+ * Description: the out-of-line form of listint_brent(), for callers
+ * that want one copy of the walk rather than an inlined one.
+ *
+ * Return: The number of distinct nodes, mu + lambda.
+ */
+size_t listint_rho(const listint_t *head, listint_rho_t *rho)
+{
+	return (listint_brent(head, rho));
+}
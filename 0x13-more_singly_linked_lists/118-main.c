@@ -0,0 +1,36 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "lists.h"
+
+/**
+ * main - check the code
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	listint_t *head, *head2;
+
+	head = NULL;
+	add_nodeint(&head, 98);
+	add_nodeint(&head, -402);
+	add_nodeint(&head, 4);
+	add_nodeint(&head, 98);
+	add_nodeint(&head, 1024);
+	add_nodeint(&head, 4);
+	sort_listint(&head);
+	printf("removed %lu\n", (unsigned long)uniq_listint(&head));
+	print_listint(head);
+	printf("-----------------\n");
+	head2 = NULL;
+	add_nodeint(&head2, 7);
+	add_nodeint(&head2, -2147483647 - 1);
+	add_nodeint(&head2, 2147483647);
+	add_nodeint(&head2, 0);
+	radix_sort_listint(&head2);
+	merge_sorted_listint(&head, &head2);
+	print_listint(head);
+	free_listint2(&head);
+	return (0);
+}
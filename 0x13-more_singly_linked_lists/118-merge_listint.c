@@ -0,0 +1,129 @@
+#include "lists.h"
+#include <stdlib.h>
+
+/**
+ * listint_merge_runs - Merges two sorted chains into one.
+ * @a: First sorted chain, NULL-terminated.
+ * @b: Second sorted chain, NULL-terminated.
+ * @tail: If not NULL, receives the last node of the result.
+ *
+ * Description: on equal values the node from @a goes first, which is
+ * what makes sort_listint() stable. Nodes are relinked, never copied.
+ *
+ * Return: The head of the merged chain.
+ */
+listint_t *listint_merge_runs(listint_t *a, listint_t *b, listint_t **tail)
+{
+	listint_t *head = NULL, **link = &head;
+
+	while (a != NULL && b != NULL)
+	{
+		if (b->n < a->n)
+		{
+			*link = b;
+			b = b->next;
+		}
+		else
+		{
+			*link = a;
+			a = a->next;
+		}
+		link = &(*link)->next;
+	}
+	*link = a != NULL ? a : b;
+
+	/* Only the leftover run is walked to find the tail */
+	if (tail != NULL)
+	{
+		while (*link != NULL && (*link)->next != NULL)
+			link = &(*link)->next;
+		*tail = *link;
+	}
+
+	return (head);
+}
+
+/**
+ * merge_sorted_listint - Merges a sorted list into another one.
+ * @a: Pointer to the head of the first sorted list; receives the result.
+ * @b: Pointer to the head of the second sorted list; set to NULL.
+ *
+ * Return: The head of the merged list.
+ */
+listint_t *merge_sorted_listint(listint_t **a, listint_t **b)
+{
+	*a = listint_merge_runs(*a, *b, NULL);
+	*b = NULL;
+
+	return (*a);
+}
+
+/**
+ * uniq_unlink - Unlinks consecutive duplicate values from a list.
+ * @head: Pointer to the head of the list.
+ * @pool: Pool to give the removed nodes back to, or NULL to free() them.
+ *
+ * Return: The number of nodes removed.
+ */
+static size_t uniq_unlink(listint_t **head, listint_pool_t *pool)
+{
+	listint_t *node, *temp;
+	size_t removed = 0;
+
+	if (head == NULL)
+		return (0);
+
+	for (node = *head; node != NULL && node->next != NULL; )
+	{
+		if (node->next->n == node->n)
+		{
+			temp = node->next;
+			node->next = temp->next;
+			if (pool != NULL)
+				listint_pool_release(pool, temp);
+			else
+				free(temp);
+			removed++;
+		}
+		else
+			node = node->next;
+	}
+
+	return (removed);
+}
+
+/**
+ * uniq_listint - Removes consecutive duplicate values from a list.
+ * @head: Pointer to the head of the list; sort it first to remove
+ *        every duplicate.
+ *
+ * Description: the first node of each run of equal values is kept;
+ * the others are freed, so every node must come from malloc(). Use
+ * uniq_listint_pool() on lists built from a listint_pool_t.
+ *
+ * Return: The number of nodes removed.
+ */
+size_t uniq_listint(listint_t **head)
+{
+	return (uniq_unlink(head, NULL));
+}
+
+/**
+ * uniq_listint_pool - Removes consecutive duplicate values from a
+ *                     pooled list.
+ * @pool: Pool the list was built from, including carved nodes.
+ * @head: Pointer to the head of the list; sort it first to remove
+ *        every duplicate.
+ *
+ * Description: as uniq_listint(), but the removed nodes go back to
+ * the pool instead of to free().
+ *
+ * Return: The number of nodes removed.
+ */
+size_t uniq_listint_pool(listint_pool_t *pool, listint_t **head)
+{
+	if (pool == NULL)
+		return (0);
+
+	return (uniq_unlink(head, pool));
+}
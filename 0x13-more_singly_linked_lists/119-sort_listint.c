@@ -0,0 +1,62 @@
+#include "lists.h"
+
+/**
+ * split_after - Cuts a chain after a number of nodes.
+ * @head: Chain to cut.
+ * @k: Number of nodes to keep in the first part.
+ *
+ * Return: The head of the rest, or NULL if the chain was short.
+ */
+static listint_t *split_after(listint_t *head, size_t k)
+{
+	listint_t *rest;
+
+	for (; head != NULL && k > 1; k--)
+		head = head->next;
+	if (head == NULL)
+		return (NULL);
+
+	rest = head->next;
+	head->next = NULL;
+
+	return (rest);
+}
+
+/**
+ * sort_listint - Sorts a listint_t list in ascending order.
+ * @head: Pointer to a pointer to the head of the list.
+ *
+ * Description: bottom-up merge sort. Each pass merges neighbouring
+ * runs of width 1, 2, 4... in a loop, so the stack use is constant
+ * and a list of any length can be sorted. Stable, O(n log n), and it
+ * only relinks the existing nodes.
+ *
+ * Return: The head of the sorted list.
+ */
+listint_t *sort_listint(listint_t **head)
+{
+	listint_t *rest, *a, *b, *tail, **link;
+	size_t width, merges = 2;
+
+	if (head == NULL)
+		return (NULL);
+
+	for (width = 1; merges > 1; width *= 2)
+	{
+		merges = 0;
+		rest = *head;
+		link = head;
+		while (rest != NULL)
+		{
+			/* Take two runs off the front and merge them */
+			a = rest;
+			b = split_after(a, width);
+			rest = split_after(b, width);
+			*link = listint_merge_runs(a, b, &tail);
+			link = &tail->next;
+			merges++;
+		}
+	}
+
+	return (*head);
+}
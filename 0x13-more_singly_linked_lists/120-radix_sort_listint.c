@@ -0,0 +1,53 @@
+#include <limits.h>
+#include <string.h>
+#include "lists.h"
+
+/* Sort key: the value with its sign bit flipped, so unsigned order works */
+#define RADIX_KEY(n) ((unsigned int)(n) ^ (1U << (sizeof(int) * CHAR_BIT - 1)))
+
+/**
+ * radix_sort_listint - Sorts a listint_t list with an LSD radix sort.
+ * @head: Pointer to a pointer to the head of the list.
+ *
+ * Description: one pass per byte of the value; each pass deals the
+ * nodes into 256 bucket chains and stitches them back in order. That
+ * is O(n) and stable, needs only the 4 KiB of bucket pointers on the
+ * stack, and never allocates a node.
+ *
+ * Return: The head of the sorted list.
+ */
+listint_t *radix_sort_listint(listint_t **head)
+{
+	listint_t *bucket[256], *last[256], *node, *next, **link;
+	unsigned int shift, b;
+
+	if (head == NULL)
+		return (NULL);
+
+	for (shift = 0; shift < sizeof(int) * CHAR_BIT; shift += 8)
+	{
+		memset(bucket, 0, sizeof(bucket));
+		for (node = *head; node != NULL; node = next)
+		{
+			next = node->next;
+			b = (RADIX_KEY(node->n) >> shift) & 0xff;
+			if (bucket[b] == NULL)
+				bucket[b] = node;
+			else
+				last[b]->next = node;
+			last[b] = node;
+		}
+
+		/* Stitch the buckets back together in order */
+		link = head;
+		for (b = 0; b < 256; b++)
+			if (bucket[b] != NULL)
+			{
+				*link = bucket[b];
+				link = &last[b]->next;
+			}
+		*link = NULL;
+	}
+
+	return (*head);
+}
@@ -0,0 +1,148 @@
+#include "lists.h"
+#include <stdlib.h>
+
+/**
+ * listint_pool_carve - Takes n contiguous nodes from a pool.
+ * @pool: Pool to allocate from.
+ * @n: Number of nodes, at least 1.
+ *
+ * Description: the nodes come from the current slab when it has
+ * room, otherwise from one new slab of exactly n nodes, so a whole
+ * list costs at most one malloc. The new slab is linked behind the
+ * current one, which stays the one that single allocations carve.
+ *
+ * Return: The first of the n nodes, or NULL if it failed.
+ */
+listint_t *listint_pool_carve(listint_pool_t *pool, size_t n)
+{
+	listint_slab_t *slab;
+	listint_t *nodes;
+
+	if ((size_t)(pool->bump_end - pool->bump) >= n)
+	{
+		nodes = pool->bump;
+		pool->bump += n;
+		return (nodes);
+	}
+
+	slab = malloc(sizeof(*slab) + n * sizeof(listint_t));
+	if (slab == NULL)
+		return (NULL);
+	slab->count = n;
+	if (pool->slabs == NULL)
+	{
+		/* Becomes the current slab, already fully used */
+		slab->next = NULL;
+		pool->slabs = slab;
+		pool->bump = (listint_t *)(slab + 1) + n;
+		pool->bump_end = pool->bump;
+	}
+	else
+	{
+		slab->next = pool->slabs->next;
+		pool->slabs->next = slab;
+	}
+
+	return ((listint_t *)(slab + 1));
+}
+
+/**
+ * listint_from_array - Builds a list from an array in one pass.
+ * @pool: Pool that will own the nodes; see free_listint_pool().
+ * @array: Values, in list order.
+ * @n: Number of values.
+ *
+ * Return: The head of the new list, or NULL if n is 0 or it failed.
+ */
+listint_t *listint_from_array(listint_pool_t *pool, const int *array,
+			      size_t n)
+{
+	listint_t *nodes;
+	size_t i;
+
+	if (n == 0)
+		return (NULL);
+	nodes = listint_pool_carve(pool, n);
+	if (nodes == NULL)
+		return (NULL);
+
+	for (i = 0; i < n; i++)
+	{
+		nodes[i].n = array[i];
+		nodes[i].next = &nodes[i + 1];
+	}
+	nodes[n - 1].next = NULL;
+
+	return (nodes);
+}
+
+/**
+ * listint_to_array - Copies the values of a list into a buffer.
+ * @h: Pointer to the head of the list.
+ * @buf: Buffer to fill.
+ * @size: Number of ints that fit in @buf.
+ *
+ * Return: The number of values written; less than the list length
+ * if @buf was too small.
+ */
+size_t listint_to_array(const listint_t *h, int *buf, size_t size)
+{
+	const listint_t *ahead = h;
+	size_t i;
+
+	for (i = 0; i < LISTINT_LOOKAHEAD && ahead != NULL; i++)
+		ahead = ahead->next;
+
+	for (i = 0; h != NULL && i < size; h = h->next)
+	{
+		if (ahead != NULL)
+		{
+			LISTINT_PREFETCH(ahead->next);
+			ahead = ahead->next;
+		}
+		buf[i++] = h->n;
+	}
+
+	return (i);
+}
+
+/**
+ * reverse_listint_copy - Makes a reversed copy of a list.
+ * @pool: Pool that will own the copy.
+ * @h: Pointer to the head of the list to copy; it is not changed.
+ *
+ * Description: counts the list, carves all the nodes at once and
+ * fills them back to front during one prefetching walk, so the copy
+ * is laid out in its own order for fast traversal.
+ *
+ * Return: The head of the copy, or NULL if @h is empty or it failed.
+ */
+listint_t *reverse_listint_copy(listint_pool_t *pool, const listint_t *h)
+{
+	listint_t *nodes;
+	size_t n = 0, i;
+	const listint_t *p, *ahead;
+
+	for (p = h; p != NULL; p = p->next)
+		n++;
+	if (n == 0)
+		return (NULL);
+	nodes = listint_pool_carve(pool, n);
+	if (nodes == NULL)
+		return (NULL);
+
+	for (i = 0, ahead = h; i < LISTINT_LOOKAHEAD && ahead != NULL; i++)
+		ahead = ahead->next;
+	for (i = n; h != NULL; h = h->next)
+	{
+		if (ahead != NULL)
+		{
+			LISTINT_PREFETCH(ahead->next);
+			ahead = ahead->next;
+		}
+		nodes[--i].n = h->n;
+		nodes[i].next = i + 1 < n ? &nodes[i + 1] : NULL;
+	}
+
+	return (nodes);
+}
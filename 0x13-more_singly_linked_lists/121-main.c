@@ -0,0 +1,29 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "lists.h"
+
+/**
+ * main - check the code
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	int values[] = {0, 1, 2, 3, 4, 98, 402, 1024};
+	int out[8];
+	listint_pool_t pool;
+	listint_t *head, *copy;
+	size_t n, i;
+
+	listint_pool_init(&pool);
+	head = listint_from_array(&pool, values, 8);
+	copy = reverse_listint_copy(&pool, head);
+	add_nodeint_pool(&pool, &copy, -1);
+	print_listint(copy);
+	n = listint_to_array(head, out, 5);
+	for (i = 0; i < n; i++)
+		printf("%d%s", out[i], i + 1 < n ? ", " : "\n");
+	free_listint_pool(&pool, &head);
+	return (0);
+}
@@ -0,0 +1,82 @@
+#include "lists.h"
+#include <stdlib.h>
+
+/**
+ * listint_segments - Splits a list into k nearly equal segments.
+ * @head: Pointer to the head of the list.
+ * @k: Number of segments wanted, at least 1.
+ * @segs: Array of at least @k segments to fill.
+ *
+ * Description: one pass. Every stride-th node is kept as a
+ * checkpoint; whenever 2k checkpoints have piled up, every other
+ * one is dropped and the stride doubles. At the end the list length
+ * is known and between k and 2k evenly spaced checkpoints remain, to
+ * be grouped into the segments. The walk itself is serial, which
+ * caps the speed-up of a one-off reduction at about 2x; the segments
+ * stay valid until the list changes, so compute them once and reuse
+ * them, or take them from listint_index_segments().
+ *
+ * Return: The number of segments filled (fewer than @k for a short
+ * list), or 0 if the list is empty or memory ran out.
+ */
+size_t listint_segments(listint_t *head, size_t k, listint_seg_t *segs)
+{
+	listint_t **mark = malloc(2 * k * sizeof(*mark));
+	size_t n, m = 0, stride = 1, i, j, end;
+
+	if (mark == NULL || head == NULL || k == 0)
+	{
+		free(mark);
+		return (0);
+	}
+	for (n = 0; head != NULL; head = head->next, n++)
+		if (n % stride == 0)
+		{
+			if (m == 2 * k)
+			{
+				for (i = 0; i < k; i++)
+					mark[i] = mark[2 * i];
+				m = k;
+				stride *= 2;
+			}
+			mark[m++] = head;
+		}
+
+	/* Segment i starts at checkpoint i * m / k; the last one runs to n */
+	k = k < m ? k : m;
+	for (i = 0; i < k; i++)
+	{
+		j = i * m / k;
+		end = i + 1 < k ? (i + 1) * m / k * stride : n;
+		segs[i].first = mark[j];
+		segs[i].count = end - j * stride;
+	}
+	free(mark);
+
+	return (k);
+}
+
+/**
+ * listint_index_segments - Splits an indexed list into k segments.
+ * @ix: Indexed list; its skip list finds each boundary in O(log n).
+ * @k: Number of segments wanted, at least 1.
+ * @segs: Array of at least @k segments to fill.
+ *
+ * Return: The number of segments filled, 0 if the list is empty.
+ */
+size_t listint_index_segments(listint_index_t *ix, size_t k,
+			      listint_seg_t *segs)
+{
+	size_t i, start, end;
+
+	k = k < ix->count ? k : ix->count;
+	for (i = 0; i < k; i++)
+	{
+		start = i * ix->count / k;
+		end = (i + 1) * ix->count / k;
+		segs[i].first = get_nodeint_at_index_ix(ix, (unsigned int)start);
+		segs[i].count = end - start;
+	}
+
+	return (k);
+}
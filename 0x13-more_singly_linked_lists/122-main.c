@@ -0,0 +1,56 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "lists.h"
+
+/**
+ * max_segment - Finds the largest value of one segment.
+ * @seg: Segment to scan.
+ * @acc: Pointer to the int partial maximum.
+ * @arg: Unused.
+ */
+void max_segment(listint_seg_t seg, void *acc, void *arg)
+{
+	(void)arg;
+	for (; seg.count > 0; seg.count--, seg.first = seg.first->next)
+		if (seg.first->n > *(int *)acc)
+			*(int *)acc = seg.first->n;
+}
+
+/**
+ * max_combine - Keeps the larger of two maxima.
+ * @acc: Pointer to the int result.
+ * @part: Pointer to an int partial maximum.
+ * @arg: Unused.
+ */
+void max_combine(void *acc, const void *part, void *arg)
+{
+	(void)arg;
+	if (*(const int *)part > *(int *)acc)
+		*(int *)acc = *(const int *)part;
+}
+
+/**
+ * main - check the code
+ *
+ * Return: Always 0.
+ */
+int main(void)
+{
+	listint_index_t ix;
+	listint_seg_t segs[8];
+	size_t nseg, i;
+	int max = -2147483647 - 1;
+
+	listint_index_init(&ix);
+	for (i = 0; i < 1000000; i++)
+		insert_nodeint_at_index_ix(&ix, ix.count, (int)(i % 1000) - 500);
+	insert_nodeint_at_index_ix(&ix, 123456, 1024);
+	printf("sum = %ld\n", listint_parallel_sum(ix.head, 8));
+	nseg = listint_index_segments(&ix, 8, segs);
+	listint_parallel_reduce(segs, nseg, max_segment, max_combine,
+				&max, sizeof(max), NULL);
+	printf("max = %d over %lu segments\n", max, (unsigned long)nseg);
+	listint_index_free(&ix);
+	return (0);
+}
@@ -0,0 +1,170 @@
+#include "lists.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Upper bound on the worker threads, whatever the core count */
+#define LISTINT_MAX_WORKERS 64
+
+/**
+ * struct listint_workers_s - the worker threads shared by every reduce
+ * @lock: protects every other field
+ * @work: signalled when a new batch is posted
+ * @done: signalled when the last worker leaves a batch
+ * @gen: batch number, bumped for each new batch
+ * @count: number of worker threads running
+ * @active: workers that have not finished the current batch yet
+ * @segs: segments of the current batch
+ * @nseg: number of segments
+ * @next: first segment nobody has taken yet
+ * @fn: callback run on each segment
+ * @parts: one private partial result per segment
+ * @acc_size: size of each partial result
+ * @arg: user argument passed to @fn
+ */
+static struct listint_workers_s
+{
+	pthread_mutex_t lock;
+	pthread_cond_t work;
+	pthread_cond_t done;
+	unsigned long gen;
+	size_t count;
+	size_t active;
+	const listint_seg_t *segs;
+	size_t nseg;
+	size_t next;
+	void (*fn)(listint_seg_t seg, void *acc, void *arg);
+	char *parts;
+	size_t acc_size;
+	void *arg;
+} workers = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER,
+	PTHREAD_COND_INITIALIZER, 0, 0, 0, NULL, 0, 0, NULL, NULL, 0, NULL};
+
+/* Lets only one reduce use the pool at a time */
+static pthread_mutex_t listint_run_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t listint_once = PTHREAD_ONCE_INIT;
+
+/**
+ * listint_drain - Runs segments of the current batch until none is left.
+ *
+ * Description: called, and returns, with workers.lock held; the
+ * lock is dropped while a segment runs.
+ */
+static void listint_drain(void)
+{
+	void *part;
+	size_t i;
+
+	while (workers.next < workers.nseg)
+	{
+		i = workers.next++;
+		part = workers.parts + i * workers.acc_size;
+		pthread_mutex_unlock(&workers.lock);
+		workers.fn(workers.segs[i], part, workers.arg);
+		pthread_mutex_lock(&workers.lock);
+	}
+}
+
+/**
+ * listint_worker - Worker thread: takes part in every batch posted.
+ * @unused: Unused.
+ *
+ * Return: Never returns; the workers live as long as the process.
+ */
+static void *listint_worker(void *unused)
+{
+	unsigned long seen = 0;
+
+	(void)unused;
+	pthread_mutex_lock(&workers.lock);
+	for (;;)
+	{
+		while (workers.gen == seen)
+			pthread_cond_wait(&workers.work, &workers.lock);
+		seen = workers.gen;
+		listint_drain();
+		if (--workers.active == 0)
+			pthread_cond_signal(&workers.done);
+	}
+
+	return (NULL);
+}
+
+/**
+ * listint_workers_start - Starts one worker per online core but one.
+ *
+ * Description: the calling thread of each reduce is the last worker.
+ * If no thread can be started, reduces simply run on the caller.
+ */
+static void listint_workers_start(void)
+{
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+	pthread_attr_t attr;
+	pthread_t thread;
+	long i;
+
+	if (cores > LISTINT_MAX_WORKERS)
+		cores = LISTINT_MAX_WORKERS;
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+	for (i = 1; i < cores; i++)
+		if (pthread_create(&thread, &attr, listint_worker, NULL) == 0)
+			workers.count++;
+	pthread_attr_destroy(&attr);
+}
+
+/**
+ * listint_parallel_reduce - Runs a callback on every segment in parallel.
+ * @segs: Segments, from listint_segments() or listint_index_segments().
+ * @nseg: Number of segments.
+ * @fn: Called once per segment with a private copy of @acc.
+ * @combine: Folds a partial into @acc; NULL for a plain parallel apply.
+ * @acc: Initial (identity) value on entry, combined result on return.
+ * @acc_size: Size of the value at @acc in bytes.
+ * @arg: User argument passed to @fn and @combine.
+ *
+ * Description: the segments are shared out among a pool of at most
+ * one thread per online core (the caller being one of them), started
+ * on first use and kept for later calls; each thread takes segments
+ * one at a time until none is left, so @nseg may exceed the core
+ * count. The partials are combined in segment order once all have
+ * finished, so the result does not depend on thread timing.
+ *
+ * Return: 1 on success, -1 if memory ran out.
+ */
+int listint_parallel_reduce(const listint_seg_t *segs, size_t nseg,
+			    void (*fn)(listint_seg_t seg, void *acc, void *arg),
+			    void (*combine)(void *acc, const void *part,
+					    void *arg),
+			    void *acc, size_t acc_size, void *arg)
+{
+	char *parts = malloc(nseg * acc_size + 1);
+	size_t i;
+
+	if (parts == NULL)
+		return (-1);
+	for (i = 0; i < nseg; i++)
+		memcpy(parts + i * acc_size, acc, acc_size);
+	pthread_once(&listint_once, listint_workers_start);
+
+	pthread_mutex_lock(&listint_run_lock);
+	pthread_mutex_lock(&workers.lock);
+	workers.segs = segs, workers.nseg = nseg, workers.next = 0;
+	workers.fn = fn, workers.parts = parts;
+	workers.acc_size = acc_size, workers.arg = arg;
+	workers.active = workers.count;
+	workers.gen++;
+	pthread_cond_broadcast(&workers.work);
+	listint_drain();
+	while (workers.active > 0)
+		pthread_cond_wait(&workers.done, &workers.lock);
+	pthread_mutex_unlock(&workers.lock);
+	pthread_mutex_unlock(&listint_run_lock);
+
+	for (i = 0; combine != NULL && i < nseg; i++)
+		combine(acc, parts + i * acc_size, arg);
+	free(parts);
+
+	return (1);
+}
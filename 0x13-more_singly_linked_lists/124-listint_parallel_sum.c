@@ -0,0 +1,58 @@
+#include "lists.h"
+#include <stdlib.h>
+
+/**
+ * sum_segment - Sums the values of one segment.
+ * @seg: Segment to sum.
+ * @acc: Pointer to the long partial sum.
+ * @arg: Unused.
+ */
+static void sum_segment(listint_seg_t seg, void *acc, void *arg)
+{
+	const listint_t *node = seg.first;
+	long sum = 0;
+
+	(void)arg;
+	for (; seg.count > 0; seg.count--, node = node->next)
+		sum += node->n;
+	*(long *)acc = sum;
+}
+
+/**
+ * sum_combine - Adds a partial sum into the total.
+ * @acc: Pointer to the long total.
+ * @part: Pointer to a long partial sum.
+ * @arg: Unused.
+ */
+static void sum_combine(void *acc, const void *part, void *arg)
+{
+	(void)arg;
+	*(long *)acc += *(const long *)part;
+}
+
+/**
+ * listint_parallel_sum - Sums a list on k threads.
+ * @head: Pointer to the head of the list.
+ * @k: Number of segments, typically the number of cores.
+ *
+ * Description: one pass finds the segment boundaries, then the
+ * segments are summed in parallel. Falls back to listint_sum64()
+ * if memory runs out.
+ *
+ * Return: The sum of all the data, or 0 if the list is empty.
+ */
+long listint_parallel_sum(listint_t *head, size_t k)
+{
+	listint_seg_t *segs = malloc(k * sizeof(*segs) + 1);
+	size_t nseg;
+	long sum = 0;
+
+	nseg = segs != NULL ? listint_segments(head, k, segs) : 0;
+	if (nseg == 0 || listint_parallel_reduce(segs, nseg, sum_segment,
+						 sum_combine, &sum, sizeof(sum),
+						 NULL) < 0)
+		sum = listint_sum64(head);
+	free(segs);
+
+	return (sum);
+}
@@ -4,13 +4,22 @@
  * sum_listint-Returns the sum of all the data (n) of a listint_t linked list.
  * @head: Pointer to the head of the list.
  *
+ * Description: walks the list in a loop rather than recursing, so the
+ * stack use no longer grows with the length of the list. Callers that
+ * need the exact total of a long list should use listint_sum64().
+ *
  * Return: The sum of all the data
  * or 0 if the list is empty.
  */
 int sum_listint(listint_t *head)
 {
-	if (head == NULL)
-		return (0);
+	long sum = 0;
+
+	while (head != NULL)
+	{
+		sum += head->n;
+		head = head->next;
+	}
 
-	return (head->n + sum_listint(head->next));
+	return ((int)sum);
 }
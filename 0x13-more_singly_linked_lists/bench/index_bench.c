@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../lists.h"
+
+/**
+ * now_ns - reads the monotonic clock
+ *
+ * Return: nanoseconds
+ */
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/**
+ * run - times random positional edits on listint_t and listint_index_t
+ * @n: number of elements kept in the list
+ *
+ * Description: each round inserts at one random index, reads another
+ * and deletes a third, so the length stays at n; the plain list does
+ * fewer rounds as it grows so that 10^5 finishes in seconds
+ *
+ * Return: 0 on success, 1 on allocation failure or mismatch
+ */
+static int run(unsigned int n)
+{
+	listint_index_t ix;
+	listint_t *head = NULL;
+	double t0, t1, t2;
+	unsigned int i, rounds = n > 1000 ? 20000000 / n : 20000;
+	long a = 0, b = 0;
+
+	listint_index_init(&ix);
+	for (i = 0; i < n; i++)
+		if (!add_nodeint(&head, i) || !insert_nodeint_at_index_ix(&ix, 0, i))
+			return (1);
+	srand(98);
+	t0 = now_ns();
+	for (i = 0; i < rounds; i++)
+	{
+		insert_nodeint_at_index(&head, rand() % n, i);
+		a += get_nodeint_at_index(head, rand() % n)->n;
+		delete_nodeint_at_index(&head, rand() % n);
+	}
+	srand(98);
+	t1 = now_ns();
+	for (i = 0; i < rounds; i++)
+	{
+		insert_nodeint_at_index_ix(&ix, rand() % n, i);
+		b += get_nodeint_at_index_ix(&ix, rand() % n)->n;
+		delete_nodeint_at_index_ix(&ix, rand() % n);
+	}
+	t2 = now_ns();
+	printf("%10u list %10.1f ns/round  indexed %8.1f ns/round%s\n", n,
+	       (t1 - t0) / rounds, (t2 - t1) / rounds, a == b ? "" : "  MISMATCH");
+	free_listint2(&head);
+	listint_index_free(&ix);
+	return (a != b);
+}
+
+/**
+ * main - benchmarks positional edits with and without the index
+ * @argc: argument count
+ * @argv: argv[1] is the largest power of ten to run (default 5)
+ *
+ * Return: 0 on success, 1 on allocation failure or mismatch
+ */
+int main(int argc, char **argv)
+{
+	int top = argc > 1 ? atoi(argv[1]) : 5, e;
+	unsigned int n = 1000;
+
+	for (e = 3; e <= top; e++, n *= 10)
+		if (run(n))
+			return (1);
+	return (0);
+}
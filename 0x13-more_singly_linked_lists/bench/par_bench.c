@@ -0,0 +1,64 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "../lists.h"
+
+/**
+ * now_ns - reads the monotonic clock
+ *
+ * Return: nanoseconds
+ */
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/**
+ * main - times listint_parallel_sum for 1, 2, 4... segments
+ * @argc: argument count
+ * @argv: argv[1] is the number of nodes (default 10^7)
+ *
+ * Description: the nodes are linked in a shuffled address order so
+ * that every step is a cache miss, as in a long-lived heap list
+ *
+ * Return: 0 on success, 1 on allocation failure or mismatch
+ */
+int main(int argc, char **argv)
+{
+	size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000, i, j, t;
+	size_t *order = malloc(n * sizeof(*order) + 1), k, cores;
+	listint_t *nodes = malloc(n * sizeof(*nodes) + 1);
+	double t0, t1;
+	long ref, sum;
+
+	if (order == NULL || nodes == NULL || n == 0)
+		return (1);
+	for (i = 0; i < n; i++)
+		order[i] = i, nodes[i].n = (int)(i % 1000);
+	for (i = n - 1; i > 0; i--)
+	{
+		j = (size_t)rand() % (i + 1);
+		t = order[i], order[i] = order[j], order[j] = t;
+	}
+	for (i = 0; i < n; i++)
+		nodes[order[i]].next = i + 1 < n ? &nodes[order[i + 1]] : NULL;
+	cores = (size_t)sysconf(_SC_NPROCESSORS_ONLN);
+	ref = listint_sum64(&nodes[order[0]]);
+	for (k = 1; k <= 2 * cores; k *= 2)
+	{
+		t0 = now_ns();
+		sum = listint_parallel_sum(&nodes[order[0]], k);
+		t1 = now_ns();
+		printf("%3lu segments %8.2f ms%s\n", (unsigned long)k,
+		       (t1 - t0) / 1e6, sum == ref ? "" : "  MISMATCH");
+		if (sum != ref)
+			return (1);
+	}
+	free(order);
+	free(nodes);
+	return (0);
+}
@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../lists.h"
+
+#define NODES 1000000
+
+/**
+ * now_ns - reads the monotonic clock
+ *
+ * Return: nanoseconds
+ */
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/**
+ * floyd_len - the former Floyd-based count, kept as the baseline
+ * @head: head of the list
+ *
+ * Return: number of distinct nodes of a looped list, 0 if not looped
+ */
+static size_t floyd_len(const listint_t *head)
+{
+	const listint_t *tortoise = head, *hare = head;
+	size_t nodes = 0;
+
+	while (hare != NULL && hare->next != NULL)
+	{
+		tortoise = tortoise->next;
+		hare = hare->next->next;
+		if (tortoise == hare)
+		{
+			for (tortoise = head; tortoise != hare; nodes++)
+				tortoise = tortoise->next, hare = hare->next;
+			for (hare = hare->next, nodes++; hare != tortoise; nodes++)
+				hare = hare->next;
+			return (nodes);
+		}
+	}
+	return (0);
+}
+
+/**
+ * make_rho - links NODES nodes into a rho in a shuffled address order
+ * @mu: length of the tail
+ * @order: scratch permutation of NODES entries
+ * @nodes: NODES nodes
+ *
+ * Return: head of the list
+ */
+static listint_t *make_rho(size_t mu, size_t *order, listint_t *nodes)
+{
+	size_t i, j, t;
+
+	for (i = 0; i < NODES; i++)
+		order[i] = i;
+	for (i = NODES - 1; i > 0; i--)
+	{
+		j = (size_t)rand() % (i + 1);
+		t = order[i], order[i] = order[j], order[j] = t;
+	}
+	for (i = 0; i + 1 < NODES; i++)
+		nodes[order[i]].next = &nodes[order[i + 1]];
+	nodes[order[NODES - 1]].next = &nodes[order[mu]];
+	return (&nodes[order[0]]);
+}
+
+/**
+ * main - times Brent (listint_rho) against Floyd on million-node rhos
+ *
+ * Return: 0 on success, 1 on allocation failure or mismatch
+ */
+int main(void)
+{
+	size_t *order = malloc(NODES * sizeof(*order)), mus[3], i, a, b;
+	listint_t *nodes = malloc(NODES * sizeof(*nodes)), *head;
+	listint_rho_t rho;
+	double t0, t1, t2;
+
+	if (order == NULL || nodes == NULL)
+		return (1);
+	mus[0] = 0, mus[1] = NODES / 2, mus[2] = NODES - 1;
+	for (i = 0; i < 3; i++)
+	{
+		head = make_rho(mus[i], order, nodes);
+		t0 = now_ns();
+		a = floyd_len(head);
+		t1 = now_ns();
+		b = listint_rho(head, &rho);
+		t2 = now_ns();
+		printf("mu %7lu lambda %7lu  floyd %7.2f ms  brent %7.2f ms%s\n",
+		       (unsigned long)mus[i], (unsigned long)(NODES - mus[i]),
+		       (t1 - t0) / 1e6, (t2 - t1) / 1e6,
+		       a == b && rho.mu == mus[i] ? "" : "  MISMATCH");
+		if (a != b)
+			return (1);
+	}
+	free(order);
+	free(nodes);
+	return (0);
+}
@@ -0,0 +1,29 @@
+#!/bin/bash
+# Benchmarks listint_t against the unrolled ulist_t from 10^3 elements
+# up to 10^${1:-7}; pass 8 for 10^8 (needs about 4 GB of memory).
+# Then times random positional edits with and without the skip-list
+# index, up to 10^${2:-5} elements, and Brent against Floyd on
+# million-node looped lists, and the parallel sum on 1, 2, 4...
+# segments (on at most one thread per core) over ${3:-10000000} nodes.
+set -e
+cd "$(dirname "$0")"
+out=$(mktemp -d)
+trap 'rm -rf "$out"' EXIT
+gcc -Wall -pedantic -Werror -Wextra -O3 ulist_bench.c ../7-get_nodeint.c \
+	../107-listint_handle.c ../108-listint_handle_ops.c \
+	../109-ulist.c ../110-ulist_insert.c ../111-ulist_delete.c \
+	../112-ulist_reverse.c ../113-listint_stats.c -o "$out/ulist_bench"
+gcc -Wall -pedantic -Werror -Wextra -O3 index_bench.c ../2-add_nodeint.c \
+	../5-free_listint2.c ../7-get_nodeint.c ../9-insert_nodeint.c \
+	../10-delete_nodeint.c ../115-listint_index.c \
+	../116-listint_index_ops.c -o "$out/index_bench"
+gcc -Wall -pedantic -Werror -Wextra -O3 rho_bench.c ../117-listint_rho.c \
+	-o "$out/rho_bench"
+gcc -Wall -pedantic -Werror -Wextra -O3 -pthread par_bench.c \
+	../113-listint_stats.c ../122-listint_segments.c \
+	../123-listint_parallel.c ../124-listint_parallel_sum.c \
+	../115-listint_index.c ../116-listint_index_ops.c -o "$out/par_bench"
+"$out/ulist_bench" "${1:-7}"
+"$out/index_bench" "${2:-5}"
+"$out/rho_bench"
+"$out/par_bench" "${3:-10000000}"
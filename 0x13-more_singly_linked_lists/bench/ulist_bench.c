@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../lists.h"
+
+/**
+ * now_ns - reads the monotonic clock
+ *
+ * Return: nanoseconds
+ */
+static double now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/**
+ * run - times build, sum and indexed get on both containers
+ * @n: number of elements
+ *
+ * Return: 0 on success, 1 on allocation failure
+ */
+static int run(size_t n)
+{
+	listint_handle_t h;
+	ulist_t u;
+	double t[7];
+	size_t i;
+	long a, b;
+
+	listint_handle_init(&h);
+	ulist_init(&u);
+	t[0] = now_ns();
+	for (i = 0; i < n; i++)
+		if (listint_handle_append(&h, (int)i) == NULL)
+			return (1);
+	t[1] = now_ns();
+	for (i = 0; i < n; i++)
+		if (ulist_add_end(&u, (int)i) == NULL)
+			return (1);
+	t[2] = now_ns();
+	a = listint_sum64(h.head);
+	t[3] = now_ns();
+	b = ulist_sum(&u);
+	t[4] = now_ns();
+	a += get_nodeint_at_index(h.head, n - 1)->n;
+	t[5] = now_ns();
+	b += *ulist_get_at_index(&u, n - 1);
+	t[6] = now_ns();
+	printf("%10lu build %6.2f/%6.2f  sum %6.3f/%6.3f  get %6.3f/%6.3f ns/elem%s\n",
+	       (unsigned long)n, (t[1] - t[0]) / n, (t[2] - t[1]) / n,
+	       (t[3] - t[2]) / n, (t[4] - t[3]) / n,
+	       (t[5] - t[4]) / n, (t[6] - t[5]) / n, a == b ? "" : "  MISMATCH");
+	listint_handle_free(&h);
+	ulist_free(&u);
+	return (a != b);
+}
+
+/**
+ * main - benchmarks listint_t against the unrolled list
+ * @argc: argument count
+ * @argv: argv[1] is the largest power of ten to run (default 7)
+ *
+ * Description: each column is listint_t / ulist_t, in ns per element
+ *
+ * Return: 0 on success, 1 on allocation failure or mismatch
+ */
+int main(int argc, char **argv)
+{
+	int top = argc > 1 ? atoi(argv[1]) : 7, e;
+	size_t n = 1000;
+
+	for (e = 3; e <= top; e++, n *= 10)
+		if (run(n))
+			return (1);
+	return (0);
+}
@@ -3,6 +3,15 @@
 
 #include <stddef.h>
 
+/* How many nodes a prefetching walk runs ahead of the reader */
+#define LISTINT_LOOKAHEAD 8
+
+#if defined(__GNUC__)
+#define LISTINT_PREFETCH(p) __builtin_prefetch(p)
+#else
+#define LISTINT_PREFETCH(p) ((void)(p))
+#endif
+
 /**
  * struct listint_s - singly linked list
  * @n: integer
@@ -16,6 +25,185 @@ typedef struct listint_s
 	struct listint_s *next;
 } listint_t;
 
+/**
+ * struct listint_slab_s - block of nodes handed out by a listint_pool_t
+ * @next: slab allocated before this one
+ * @count: number of nodes that follow this header in memory
+ *
+ * Description: the nodes are stored right after the header, so one
+ * malloc covers a whole slab
+ */
+typedef struct listint_slab_s
+{
+	struct listint_slab_s *next;
+	size_t count;
+} listint_slab_t;
+
+/**
+ * struct listint_pool_s - per-list allocator for listint_t nodes
+ * @slabs: every slab owned by the pool, newest first
+ * @free: released nodes, chained through their next pointers
+ * @bump: next never-used node of the newest slab
+ * @bump_end: one past the last node of the newest slab
+ * @slab_nodes: size of the next slab, doubled up to a cap
+ *
+ * Description: nodes are ordinary listint_t, so every read-only
+ * function (print, len, get, sum, reverse...) works on pooled lists;
+ * only the *_pool functions may add, remove or free pooled nodes
+ */
+typedef struct listint_pool_s
+{
+	listint_slab_t *slabs;
+	listint_t *free;
+	listint_t *bump;
+	listint_t *bump_end;
+	size_t slab_nodes;
+} listint_pool_t;
+
+/**
+ * struct listint_handle_s - list plus cached tail and length
+ * @head: first node, usable with every listint_t ** function
+ * @tail: last node, NULL when the list is empty
+ * @count: number of nodes
+ *
+ * Description: lets append, prepend, pop and len run in O(1). After
+ * editing @head through the raw API, call listint_handle_attach()
+ * again to refresh @tail and @count
+ */
+typedef struct listint_handle_s
+{
+	listint_t *head;
+	listint_t *tail;
+	size_t count;
+} listint_handle_t;
+
+/* ints per unrolled node: 28 * 4 + 4 + 4 (pad) + 8 = two cache lines */
+#define ULIST_CAP 28
+
+/**
+ * struct ulist_node_s - unrolled list node holding up to ULIST_CAP ints
+ * @n: values, in list order; slots at and past @count are always 0
+ * @count: number of values in use
+ * @next: points to the next node
+ *
+ * Description: keeping the unused slots zeroed lets ulist_sum() add
+ * the whole fixed-size array with no per-node bound, which the
+ * compiler turns into straight SIMD code
+ */
+typedef struct ulist_node_s
+{
+	int n[ULIST_CAP];
+	unsigned int count;
+	struct ulist_node_s *next;
+} ulist_node_t;
+
+/**
+ * struct ulist_s - unrolled linked list of ints
+ * @head: first node
+ * @tail: last node
+ * @count: total number of values
+ */
+typedef struct ulist_s
+{
+	ulist_node_t *head;
+	ulist_node_t *tail;
+	size_t count;
+} ulist_t;
+
+/**
+ * struct listint_stats_s - aggregates of a listint_t list
+ * @sum: sum of all the values, 64 bits wide so it cannot overflow
+ * @min: smallest value, 0 for an empty list
+ * @max: largest value, 0 for an empty list
+ * @count: number of nodes
+ */
+typedef struct listint_stats_s
+{
+	long sum;
+	int min;
+	int max;
+	size_t count;
+} listint_stats_t;
+
+/* Index levels above the plain list; enough for 4^16 nodes */
+#define LISTINT_SKIP_LEVELS 16
+
+typedef struct listint_skip_s listint_skip_t;
+
+/**
+ * struct listint_link_s - one forward link of a skip-list tower
+ * @next: next tower on the same level, or NULL
+ * @width: how many list nodes the link jumps over; a NULL link
+ *         jumps to one past the last node
+ */
+typedef struct listint_link_s
+{
+	listint_skip_t *next;
+	size_t width;
+} listint_link_t;
+
+/**
+ * struct listint_skip_s - index tower standing for one list node
+ * @node: the listint_t node this tower indexes
+ * @height: number of entries in @link
+ * @link: forward links, level 1 first; allocated to @height entries
+ */
+struct listint_skip_s
+{
+	listint_t *node;
+	int height;
+	listint_link_t link[1];
+};
+
+/**
+ * struct listint_index_s - listint_t list with an order-statistics
+ *                          skip list on top of it
+ * @head: first node; the bottom level is the plain listint_t chain,
+ *        so every read-only list function works on it
+ * @count: number of nodes
+ * @levels: number of index levels in use
+ * @seed: state of the generator that picks tower heights
+ * @top: links leaving the header, one per level
+ *
+ * Description: gives O(log n) expected get, insert and delete by
+ * index. Only about a quarter of the nodes carry a tower
+ */
+typedef struct listint_index_s
+{
+	listint_t *head;
+	size_t count;
+	int levels;
+	unsigned long seed;
+	listint_link_t top[LISTINT_SKIP_LEVELS];
+} listint_index_t;
+
+/**
+ * struct listint_rho_s - shape of a possibly looped listint_t list
+ * @mu: number of nodes before the loop (the whole list if none)
+ * @lambda: number of nodes in the loop, 0 if there is none
+ * @entry: first node of the loop, NULL if there is none
+ *
+ * Description: a looped list is shaped like the letter rho: a tail
+ * of @mu nodes leading into a cycle of @lambda nodes
+ */
+typedef struct listint_rho_s
+{
+	size_t mu;
+	size_t lambda;
+	const listint_t *entry;
+} listint_rho_t;
+
+/**
+ * struct listint_seg_s - a run of consecutive nodes of a list
+ * @first: first node of the run
+ * @count: number of nodes in the run
+ */
+typedef struct listint_seg_s
+{
+	listint_t *first;
+	size_t count;
+} listint_seg_t;
+
 /* Function prototypes */
 size_t print_listint(const listint_t *h);
 size_t listint_len(const listint_t *h);
@@ -32,5 +220,148 @@ listint_t *reverse_listint(listint_t **head);
 size_t print_listint_safe(const listint_t *head);
 size_t free_listint_safe(listint_t **h);
 listint_t *find_listint_loop(listint_t *head);
+size_t listint_rho(const listint_t *head, listint_rho_t *rho);
+
+/* Ordering (all in place, no allocation, no recursion) */
+listint_t *listint_merge_runs(listint_t *a, listint_t *b, listint_t **tail);
+listint_t *merge_sorted_listint(listint_t **a, listint_t **b);
+size_t uniq_listint(listint_t **head);
+size_t uniq_listint_pool(listint_pool_t *pool, listint_t **head);
+listint_t *sort_listint(listint_t **head);
+listint_t *radix_sort_listint(listint_t **head);
+
+/* Bulk conversion */
+listint_t *listint_pool_carve(listint_pool_t *pool, size_t n);
+listint_t *listint_from_array(listint_pool_t *pool, const int *array,
+			      size_t n);
+size_t listint_to_array(const listint_t *h, int *buf, size_t size);
+listint_t *reverse_listint_copy(listint_pool_t *pool, const listint_t *h);
+
+/* Parallel map/reduce */
+size_t listint_segments(listint_t *head, size_t k, listint_seg_t *segs);
+size_t listint_index_segments(listint_index_t *ix, size_t k,
+			      listint_seg_t *segs);
+int listint_parallel_reduce(const listint_seg_t *segs, size_t nseg,
+			    void (*fn)(listint_seg_t seg, void *acc, void *arg),
+			    void (*combine)(void *acc, const void *part,
+					    void *arg),
+			    void *acc, size_t acc_size, void *arg);
+long listint_parallel_sum(listint_t *head, size_t k);
+
+/* Pooled node allocation */
+void listint_pool_init(listint_pool_t *pool);
+listint_t *listint_pool_alloc(listint_pool_t *pool);
+void listint_pool_release(listint_pool_t *pool, listint_t *node);
+void listint_pool_destroy(listint_pool_t *pool);
+listint_t *add_nodeint_pool(listint_pool_t *pool, listint_t **head,
+			    const int n);
+listint_t *add_nodeint_end_pool(listint_pool_t *pool, listint_t **head,
+				const int n);
+listint_t *insert_nodeint_at_index_pool(listint_pool_t *pool,
+					listint_t **head, unsigned int idx,
+					int n);
+int pop_listint_pool(listint_pool_t *pool, listint_t **head);
+int delete_nodeint_at_index_pool(listint_pool_t *pool, listint_t **head,
+				 unsigned int index);
+void free_listint_pool(listint_pool_t *pool, listint_t **head);
+
+/* O(1) list handle */
+void listint_handle_init(listint_handle_t *h);
+size_t listint_handle_attach(listint_handle_t *h, listint_t *head);
+listint_t *listint_handle_detach(listint_handle_t *h);
+size_t listint_handle_len(const listint_handle_t *h);
+listint_t *listint_handle_append(listint_handle_t *h, const int n);
+listint_t *listint_handle_prepend(listint_handle_t *h, const int n);
+int listint_handle_pop(listint_handle_t *h);
+void listint_handle_free(listint_handle_t *h);
+
+/* Unrolled list */
+void ulist_init(ulist_t *l);
+void ulist_free(ulist_t *l);
+size_t ulist_print(const ulist_t *l);
+int *ulist_get_at_index(const ulist_t *l, size_t index);
+int *ulist_insert_at_index(ulist_t *l, size_t idx, int n);
+int *ulist_add(ulist_t *l, int n);
+int *ulist_add_end(ulist_t *l, int n);
+int ulist_delete_at_index(ulist_t *l, size_t index);
+int ulist_pop(ulist_t *l);
+void ulist_reverse(ulist_t *l);
+long ulist_sum(const ulist_t *l);
+
+/* Aggregates */
+size_t listint_stats(const listint_t *h, listint_stats_t *st);
+long listint_sum64(const listint_t *h);
+int listint_minmax(const listint_t *h, int *min, int *max);
+size_t listint_count_if(const listint_t *h, int (*pred)(int n, void *arg),
+			void *arg);
+double listint_mean(const listint_t *h);
+/* Only for a list that is the sole user of its pool */
+size_t listint_pool_stats(const listint_pool_t *pool, const listint_t *head,
+			  listint_stats_t *st);
+
+/* Indexed backend */
+void listint_index_init(listint_index_t *ix);
+int listint_skip_tower(listint_index_t *ix, listint_t *node,
+		       listint_skip_t **tower);
+int listint_index_build(listint_index_t *ix, listint_t *head);
+listint_t *listint_index_clear(listint_index_t *ix);
+void listint_index_free(listint_index_t *ix);
+listint_t *get_nodeint_at_index_ix(listint_index_t *ix, unsigned int index);
+listint_t *insert_nodeint_at_index_ix(listint_index_t *ix, unsigned int idx,
+				      int n);
+int delete_nodeint_at_index_ix(listint_index_t *ix, unsigned int index);
+
+/**
+ * listint_brent - Measures the tail and loop of a listint_t list.
+ * @head: Pointer to the head of the list.
+ * @rho: Where to store the shape of the list.
+ *
+ * Description: Brent's algorithm, inline so that 101-103 build on
+ * their own. The hare only ever moves one step at a time and the
+ * tortoise teleports to it at every power of two, so the loop length
+ * falls out of the detection walk itself and needs no counting lap.
+ * A second walk with two pointers lambda apart then finds where the
+ * loop starts. Nothing depends on node addresses.
+ *
+ * Return: The number of distinct nodes, mu + lambda.
+ */
+static __inline__ size_t listint_brent(const listint_t *head,
+				       listint_rho_t *rho)
+{
+	const listint_t *tortoise = head, *hare;
+	size_t power = 1, lam = 1, steps = 1;
+
+	rho->mu = 0;
+	rho->lambda = 0;
+	rho->entry = NULL;
+	if (head == NULL)
+		return (0);
+	for (hare = head->next; hare != tortoise; hare = hare->next, lam++)
+	{
+		if (hare == NULL)
+		{
+			rho->mu = steps;
+			return (steps);
+		}
+		if (power == lam)
+		{
+			tortoise = hare;
+			power *= 2;
+			lam = 0;
+		}
+		steps++;
+	}
+	rho->lambda = lam;
+	for (tortoise = hare = head; lam > 0; lam--)
+		hare = hare->next;
+	for (; tortoise != hare; rho->mu++)
+	{
+		tortoise = tortoise->next;
+		hare = hare->next;
+	}
+	rho->entry = tortoise;
+
+	return (rho->mu + rho->lambda);
+}
 
 #endif /* LISTS_H */
@@ -1,20 +1,56 @@
+#include <errno.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <stdlib.h>
 #include "main.h"
 
+/* The buffer never grows past this, however many letters are asked */
+#define READ_BUF_MAX (64 * 1024)
+
+/**
+ * write_all - writes a whole buffer, resuming after short writes.
+ * @fd: file descriptor to write to.
+ * @buffer: bytes to write.
+ * @len: number of bytes.
+ *
+ * Return: 0 on success, -1 on failure.
+ */
+static int write_all(int fd, const char *buffer, size_t len)
+{
+	ssize_t bytes_written;
+
+	while (len > 0)
+	{
+		bytes_written = write(fd, buffer, len);
+		if (bytes_written == -1 && errno == EINTR)
+			continue;
+		if (bytes_written <= 0)
+			return (-1);
+		buffer += bytes_written;
+		len -= bytes_written;
+	}
+
+	return (0);
+}
+
 /**
  * read_textfile - Reads and prints the content of a text file.
  * @filename: The name of the file to be read.
  * @letters: The number of letters to read and print.
  *
+ * Description: the file goes through a buffer of at most
+ * READ_BUF_MAX bytes, so memory use does not depend on @letters;
+ * short reads and short writes are carried on until @letters bytes
+ * or the end of the file.
+ *
  * Return: The actual number of letters read and printed
  * or 0 on failure.
  */
 ssize_t read_textfile(const char *filename, size_t letters)
 {
 	int fd;
-	ssize_t bytes_read, bytes_written;
+	ssize_t bytes_read, total = 0;
+	size_t size = letters < READ_BUF_MAX ? letters : READ_BUF_MAX;
 	char *buffer;
 
 	if (filename == NULL)
@@ -24,30 +60,32 @@ ssize_t read_textfile(const char *filename, size_t letters)
 	if (fd == -1)
 		return (0);
 
-	buffer = malloc(sizeof(char) * letters);
+	buffer = malloc(sizeof(char) * (size ? size : 1));
 	if (buffer == NULL)
 	{
 		close(fd);
 		return (0);
 	}
 
-	bytes_read = read(fd, buffer, letters);
-	if (bytes_read == -1)
+	while ((size_t)total < letters)
 	{
-		free(buffer);
-		close(fd);
-		return (0);
-	}
-
-	bytes_written = write(STDOUT_FILENO, buffer, bytes_read);
-	if (bytes_written != bytes_read || bytes_written == -1)
-	{
-		free(buffer);
-		close(fd);
-		return (0);
+		size = letters - total < READ_BUF_MAX ? letters - total : READ_BUF_MAX;
+		bytes_read = read(fd, buffer, size);
+		if (bytes_read == -1 && errno == EINTR)
+			continue;
+		if (bytes_read == 0)
+			break;
+		if (bytes_read == -1 ||
+		    write_all(STDOUT_FILENO, buffer, bytes_read) == -1)
+		{
+			free(buffer);
+			close(fd);
+			return (0);
+		}
+		total += bytes_read;
 	}
 
 	free(buffer);
 	close(fd);
-	return (bytes_written);
+	return (total);
 }
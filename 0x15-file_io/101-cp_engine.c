@@ -0,0 +1,30 @@
+#define _GNU_SOURCE
+#include "cp_inline.h"
+
+/**
+ * cp_engine - copies everything left in fd_from to fd_to
+ * @fd_from: file descriptor to read from
+ * @fd_to: file descriptor to write to (not opened with O_APPEND)
+ * @st: filled with the path used, the byte count and the time taken
+ *
+ * Description: the out-of-line form of cp_engine_inline(): tries
+ * copy_file_range(), then sendfile(), then a read/write loop, each
+ * path handing over at the current offsets
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure
+ */
+int cp_engine(int fd_from, int fd_to, cp_stats_t *st)
+{
+	return (cp_engine_inline(fd_from, fd_to, st));
+}
+
+/**
+ * cp_report - prints the path and throughput of a copy on stderr
+ * @from: source file name
+ * @to: destination file name
+ * @st: stats from cp_engine()
+ */
+void cp_report(const char *from, const char *to, const cp_stats_t *st)
+{
+	cp_report_inline(from, to, st, "");
+}
@@ -0,0 +1,30 @@
+#define _GNU_SOURCE
+#include "cp_inline.h"
+
+/**
+ * cp_write_all - writes a whole buffer, resuming after short writes
+ * @fd: file descriptor to write to
+ * @buf: bytes to write
+ * @len: number of bytes
+ *
+ * Return: len on success, -1 on error
+ */
+ssize_t cp_write_all(int fd, const char *buf, size_t len)
+{
+	return (cp_write_all_inline(fd, buf, len));
+}
+
+/**
+ * cp_read_write - copies with read() and write() until end of file
+ * @fd_from: file descriptor to read from
+ * @fd_to: file descriptor to write to
+ * @st: stats; bytes copied are added to st->bytes
+ *
+ * Description: the out-of-line form of cp_read_write_inline()
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure
+ */
+int cp_read_write(int fd_from, int fd_to, cp_stats_t *st)
+{
+	return (cp_read_write_inline(fd_from, fd_to, st));
+}
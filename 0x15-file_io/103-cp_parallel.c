@@ -0,0 +1,184 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+#include "main.h"
+
+/* Size of the ranges handed out to the workers */
+#define CP_PAR_CHUNK (64L << 20)
+/* Buffer of each worker when copy_file_range() is not usable */
+#define CP_PAR_BUF (1L << 20)
+
+/**
+ * struct cp_job_s - state shared by the workers of cp_parallel()
+ * @fd_from: source file descriptor
+ * @fd_to: destination file descriptor
+ * @size: number of bytes to copy
+ * @next: offset of the next range nobody has taken yet
+ * @error: first error seen (CP_ERR_READ or CP_ERR_WRITE), or 0
+ * @fallback: set once a range had to use pread()/pwrite()
+ * @lock: protects @next, @error and @fallback
+ */
+typedef struct cp_job_s
+{
+	int fd_from;
+	int fd_to;
+	off_t size;
+	off_t next;
+	int error;
+	int fallback;
+	pthread_mutex_t lock;
+} cp_job_t;
+
+/**
+ * cp_range_rw - copies one range with pread() and pwrite()
+ * @job: the shared job
+ * @off: offset of the range, the same in both files
+ * @len: length of the range
+ * @buf: CP_PAR_BUF bytes of scratch space
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure
+ */
+static int cp_range_rw(cp_job_t *job, off_t off, off_t len, char *buf)
+{
+	ssize_t n, w, done;
+
+	while (len > 0)
+	{
+		n = len < CP_PAR_BUF ? len : CP_PAR_BUF;
+		n = pread(job->fd_from, buf, n, off);
+		if (n == -1 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return (CP_ERR_READ);
+		for (done = 0; done < n; done += w)
+		{
+			w = pwrite(job->fd_to, buf + done, n - done, off + done);
+			if (w == -1 && errno == EINTR)
+				w = 0;
+			else if (w <= 0)
+				return (CP_ERR_WRITE);
+		}
+		off += n;
+		len -= n;
+	}
+
+	return (0);
+}
+
+/**
+ * cp_range - copies one range, in the kernel when it can
+ * @job: the shared job
+ * @off: offset of the range, the same in both files
+ * @len: length of the range
+ * @buf: scratch space for the pread()/pwrite() fallback
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure
+ */
+static int cp_range(cp_job_t *job, off_t off, off_t len, char *buf)
+{
+	loff_t in = off, out = off;
+	ssize_t n;
+
+	while (len > 0)
+	{
+		n = copy_file_range(job->fd_from, &in, job->fd_to, &out, len, 0);
+		if (n <= 0)
+			break;
+		len -= n;
+	}
+	if (len == 0)
+		return (0);
+
+	pthread_mutex_lock(&job->lock);
+	job->fallback = 1;
+	pthread_mutex_unlock(&job->lock);
+
+	return (cp_range_rw(job, in, len, buf));
+}
+
+/**
+ * cp_worker - takes ranges from the job until none are left
+ * @arg: the shared cp_job_t
+ *
+ * Return: Always NULL.
+ */
+static void *cp_worker(void *arg)
+{
+	cp_job_t *job = arg;
+	char *buf = malloc(CP_PAR_BUF);
+	off_t off, len;
+	int err;
+
+	for (err = buf == NULL ? CP_ERR_READ : 0; err == 0; )
+	{
+		pthread_mutex_lock(&job->lock);
+		off = job->error ? job->size : job->next;
+		job->next = off + CP_PAR_CHUNK;
+		pthread_mutex_unlock(&job->lock);
+		if (off >= job->size)
+			break;
+		len = job->size - off;
+		err = cp_range(job, off, len < CP_PAR_CHUNK ? len : CP_PAR_CHUNK, buf);
+	}
+	pthread_mutex_lock(&job->lock);
+	if (err != 0 && job->error == 0)
+		job->error = err;
+	pthread_mutex_unlock(&job->lock);
+	free(buf);
+
+	return (NULL);
+}
+
+/**
+ * cp_parallel - copies a regular file with several threads
+ * @fd_from: file descriptor to read from, at offset 0
+ * @fd_to: empty file descriptor to write to
+ * @threads: number of worker threads
+ * @st: filled with the path used, the byte count and the time taken
+ *
+ * Description: the destination is preallocated to the source size,
+ * then the workers copy 64 MiB ranges at the same offset in both
+ * files, so several I/Os are in flight at once. At most 64 threads
+ * are used and the file offsets are left alone. Unless both files
+ * are regular and the source spans more than one range, the copy
+ * goes to cp_engine() instead
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure
+ */
+int cp_parallel(int fd_from, int fd_to, int threads, cp_stats_t *st)
+{
+	pthread_t tid[64];
+	struct timespec t0, t1;
+	struct stat sb, db;
+	cp_job_t job;
+	int i, started = 0;
+
+	if (threads < 2 || fstat(fd_from, &sb) == -1 || !S_ISREG(sb.st_mode) ||
+	    sb.st_size <= CP_PAR_CHUNK || fstat(fd_to, &db) == -1 ||
+	    !S_ISREG(db.st_mode))
+		return (cp_engine(fd_from, fd_to, st));
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	if (fallocate(fd_to, 0, 0, sb.st_size) == -1 &&
+	    ftruncate(fd_to, sb.st_size) == -1)
+		return (CP_ERR_WRITE);
+	job.fd_from = fd_from, job.fd_to = fd_to, job.size = sb.st_size;
+	job.next = 0, job.error = 0, job.fallback = 0;
+	pthread_mutex_init(&job.lock, NULL);
+	threads = threads < 64 ? threads : 64;
+	for (i = 1; i < threads; i++)
+		started += pthread_create(&tid[started], NULL, cp_worker, &job) == 0;
+	cp_worker(&job);
+	for (i = 0; i < started; i++)
+		pthread_join(tid[i], NULL);
+	pthread_mutex_destroy(&job.lock);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	st->method = job.fallback ? "parallel pread/pwrite" :
+		"parallel copy_file_range";
+	st->bytes = job.error ? 0 : job.size;
+	st->threads = started + 1;
+	st->seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+	return (job.error);
+}
@@ -0,0 +1,139 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include "main.h"
+#include "uring.h"
+
+/**
+ * uring_init - sets up an io_uring instance
+ * @u: ring to initialise
+ * @entries: submission queue depth
+ *
+ * Return: 0 on success, -1 if io_uring is unavailable (old kernel,
+ * seccomp filter, io_uring_disabled...) so the caller can stay sync
+ */
+int uring_init(uring_t *u, unsigned int entries)
+{
+	struct io_uring_params p;
+	char *sq, *cq;
+
+	memset(&p, 0, sizeof(p));
+	memset(u, 0, sizeof(*u));
+	u->fd = syscall(__NR_io_uring_setup, entries, &p);
+	if (u->fd < 0)
+		return (-1);
+	u->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+	u->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	u->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	u->sq_ring = mmap(NULL, u->sq_len, PROT_READ | PROT_WRITE,
+			  MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQ_RING);
+	u->cq_ring = mmap(NULL, u->cq_len, PROT_READ | PROT_WRITE,
+			  MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_CQ_RING);
+	u->sqes = mmap(NULL, u->sqes_len, PROT_READ | PROT_WRITE,
+		       MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQES);
+	if (u->sq_ring == MAP_FAILED || u->cq_ring == MAP_FAILED ||
+	    u->sqes == MAP_FAILED)
+	{
+		uring_exit(u);
+		return (-1);
+	}
+	sq = u->sq_ring, cq = u->cq_ring;
+	u->sq_head = (unsigned int *)(sq + p.sq_off.head);
+	u->sq_tail = (unsigned int *)(sq + p.sq_off.tail);
+	u->sq_mask = (unsigned int *)(sq + p.sq_off.ring_mask);
+	u->sq_array = (unsigned int *)(sq + p.sq_off.array);
+	u->cq_head = (unsigned int *)(cq + p.cq_off.head);
+	u->cq_tail = (unsigned int *)(cq + p.cq_off.tail);
+	u->cq_mask = (unsigned int *)(cq + p.cq_off.ring_mask);
+	u->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+	return (0);
+}
+
+/**
+ * uring_exit - unmaps and closes an io_uring instance
+ * @u: ring to tear down
+ */
+void uring_exit(uring_t *u)
+{
+	if (u->sq_ring != NULL && u->sq_ring != MAP_FAILED)
+		munmap(u->sq_ring, u->sq_len);
+	if (u->cq_ring != NULL && u->cq_ring != MAP_FAILED)
+		munmap(u->cq_ring, u->cq_len);
+	if (u->sqes != NULL && u->sqes != MAP_FAILED)
+		munmap(u->sqes, u->sqes_len);
+	if (u->fd >= 0)
+		close(u->fd);
+	u->fd = -1;
+}
+
+/**
+ * uring_sqe - takes the next free submission entry
+ * @u: ring
+ *
+ * Return: a zeroed entry to fill in, or NULL if the queue is full
+ * (call uring_submit() and reap some completions first)
+ */
+struct io_uring_sqe *uring_sqe(uring_t *u)
+{
+	unsigned int head = __atomic_load_n(u->sq_head, __ATOMIC_ACQUIRE);
+	unsigned int tail = *u->sq_tail + u->queued, idx;
+
+	if (tail - head > *u->sq_mask)
+		return (NULL);
+	idx = tail & *u->sq_mask;
+	u->sq_array[idx] = idx;
+	u->queued++;
+	memset(&u->sqes[idx], 0, sizeof(u->sqes[idx]));
+
+	return (&u->sqes[idx]);
+}
+
+/**
+ * uring_submit - hands queued entries to the kernel in one system call
+ * @u: ring
+ * @wait: number of completions to wait for
+ *
+ * Description: entries the kernel did not take on an earlier call,
+ * after a partial submit or an error, are still in the ring between
+ * its head and our tail and are submitted again here. EINTR is
+ * retried; EAGAIN or EBUSY mean completions must be reaped first
+ *
+ * Return: number of entries submitted, or -1 on error (errno is set)
+ */
+int uring_submit(uring_t *u, unsigned int wait)
+{
+	unsigned int tail = *u->sq_tail + u->queued, todo;
+	int ret;
+
+	__atomic_store_n(u->sq_tail, tail, __ATOMIC_RELEASE);
+	u->queued = 0;
+	do {
+		todo = tail - __atomic_load_n(u->sq_head, __ATOMIC_ACQUIRE);
+		ret = syscall(__NR_io_uring_enter, u->fd, todo, wait,
+			      wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+	} while (ret == -1 && errno == EINTR);
+
+	return (ret < 0 ? -1 : ret);
+}
+
+/**
+ * uring_cqe - pops one completion, if any
+ * @u: ring
+ * @cqe: where to copy the completion
+ *
+ * Return: 1 if a completion was popped, 0 if none is ready
+ */
+int uring_cqe(uring_t *u, struct io_uring_cqe *cqe)
+{
+	unsigned int head = *u->cq_head;
+
+	if (head == __atomic_load_n(u->cq_tail, __ATOMIC_ACQUIRE))
+		return (0);
+	*cqe = u->cqes[head & *u->cq_mask];
+	__atomic_store_n(u->cq_head, head + 1, __ATOMIC_RELEASE);
+
+	return (1);
+}
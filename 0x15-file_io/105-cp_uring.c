@@ -0,0 +1,258 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <time.h>
+#include <sys/uio.h>
+#include <sys/syscall.h>
+#include "main.h"
+#include "uring.h"
+
+/* Size of each of the URING_DEPTH buffers */
+#define CP_URING_BUF (256L << 10)
+
+/**
+ * struct cp_slot_s - one buffer of the io_uring copy and its range
+ * @off: offset of the range, the same in both files
+ * @len: length of the range
+ * @done: bytes of the range read (or written) so far
+ * @writing: 1 once the range is being written out
+ */
+typedef struct cp_slot_s
+{
+	off_t off;
+	size_t len;
+	size_t done;
+	int writing;
+} cp_slot_t;
+
+/**
+ * struct cp_ring_s - state of an io_uring copy
+ * @u: the ring
+ * @fd_from: source file descriptor
+ * @fd_to: destination file descriptor
+ * @size: number of bytes to copy; lowered if the source shrinks
+ * @next: offset of the next range nobody has read yet
+ * @fixed: 1 if the buffers are registered with the kernel
+ * @error: first error seen (CP_ERR_READ or CP_ERR_WRITE), or 0
+ * @inflight: number of I/Os submitted but not completed
+ * @buf: URING_DEPTH buffers of CP_URING_BUF bytes each
+ * @slot: the ranges held by those buffers
+ */
+typedef struct cp_ring_s
+{
+	uring_t u;
+	int fd_from;
+	int fd_to;
+	off_t size;
+	off_t next;
+	int fixed;
+	int error;
+	int inflight;
+	char *buf;
+	cp_slot_t slot[URING_DEPTH];
+} cp_ring_t;
+
+/**
+ * cp_uring_queue - queues the next read or write of a slot
+ * @r: the copy
+ * @i: index of the slot
+ * @fresh: 1 to give the slot the next range first, if any is left
+ *
+ * Description: a slot always has at most one I/O in flight and the
+ * ring is as deep as there are slots, so an entry is always free
+ */
+static void cp_uring_queue(cp_ring_t *r, int i, int fresh)
+{
+	struct io_uring_sqe *sqe;
+	cp_slot_t *s = &r->slot[i];
+
+	if (fresh)
+	{
+		if (r->error || r->next >= r->size)
+			return;
+		s->off = r->next;
+		s->len = r->size - r->next < CP_URING_BUF ?
+			(size_t)(r->size - r->next) : (size_t)CP_URING_BUF;
+		s->done = 0;
+		s->writing = 0;
+		r->next += s->len;
+	}
+	sqe = uring_sqe(&r->u);
+	if (s->writing)
+		sqe->opcode = r->fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+	else
+		sqe->opcode = r->fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+	sqe->fd = s->writing ? r->fd_to : r->fd_from;
+	sqe->off = s->off + s->done;
+	sqe->addr = (unsigned long)(r->buf + i * CP_URING_BUF + s->done);
+	sqe->len = s->len - s->done;
+	sqe->buf_index = i;
+	sqe->user_data = i;
+	r->inflight++;
+}
+
+/**
+ * cp_uring_done - handles the completion of a slot's I/O
+ * @r: the copy
+ * @cqe: the completion
+ *
+ * Description: short reads and writes are queued again for the rest
+ * of the range; a read that hits end of file early means the source
+ * shrank, so the copy stops there
+ */
+static void cp_uring_done(cp_ring_t *r, const struct io_uring_cqe *cqe)
+{
+	int i = (int)cqe->user_data;
+	cp_slot_t *s = &r->slot[i];
+
+	r->inflight--;
+	if (cqe->res == -EINTR || cqe->res == -EAGAIN)
+	{
+		cp_uring_queue(r, i, 0);
+		return;
+	}
+	if (cqe->res < 0 || (s->writing && cqe->res == 0))
+	{
+		if (r->error == 0)
+			r->error = s->writing ? CP_ERR_WRITE : CP_ERR_READ;
+		return;
+	}
+	if (cqe->res == 0 && s->off + (off_t)s->done < r->size)
+		r->size = s->off + s->done;
+	s->done += cqe->res;
+	if (cqe->res == 0 || s->done == s->len)
+	{
+		s->len = s->done;
+		s->done = 0;
+		s->writing = !s->writing;
+		if (!s->writing || s->len == 0)
+		{
+			cp_uring_queue(r, i, 1);
+			return;
+		}
+	}
+	if (r->error == 0)
+		cp_uring_queue(r, i, 0);
+}
+
+/**
+ * cp_uring_run - keeps URING_DEPTH ranges in flight until the end
+ * @r: the copy, with its ring and buffers set up
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure
+ */
+static int cp_uring_run(cp_ring_t *r)
+{
+	struct io_uring_cqe cqe;
+	int i;
+
+	for (i = 0; i < URING_DEPTH; i++)
+		cp_uring_queue(r, i, 1);
+	while (r->inflight > 0)
+	{
+		/* EAGAIN and EBUSY clear once completions are reaped */
+		if (uring_submit(&r->u, 1) == -1 && errno != EAGAIN &&
+		    errno != EBUSY)
+		{
+			r->error = CP_ERR_READ;
+			break;
+		}
+		while (uring_cqe(&r->u, &cqe))
+			cp_uring_done(r, &cqe);
+	}
+	if (r->error == 0 && ftruncate(r->fd_to, r->size) == -1)
+		r->error = CP_ERR_WRITE;
+
+	return (r->error);
+}
+
+/**
+ * cp_uring_open - sets up the ring and buffers of an io_uring copy
+ *
+ * Description: a ring without IORING_OP_READ and IORING_OP_WRITE
+ * counts as no ring, before anything is written. The buffers are
+ * registered with the kernel when it lets us, which saves pinning
+ * the pages on every I/O; otherwise plain reads and writes are used
+ *
+ * Return: the zeroed copy state, or NULL if io_uring or the opcodes
+ * it needs are unavailable, or memory ran out
+ */
+static cp_ring_t *cp_uring_open(void)
+{
+	static const __u8 ops[] = {IORING_OP_READ, IORING_OP_WRITE};
+	struct iovec iov[URING_DEPTH];
+	cp_ring_t *r = calloc(1, sizeof(*r));
+	int i;
+
+	if (r == NULL || posix_memalign((void **)&r->buf, 4096,
+					URING_DEPTH * CP_URING_BUF) != 0)
+	{
+		free(r);
+		return (NULL);
+	}
+	if (uring_init(&r->u, URING_DEPTH) == -1 || !uring_probe(&r->u, ops, 2))
+	{
+		if (r->u.fd >= 0)
+			uring_exit(&r->u);
+		free(r->buf);
+		free(r);
+		return (NULL);
+	}
+	for (i = 0; i < URING_DEPTH; i++)
+	{
+		iov[i].iov_base = r->buf + i * CP_URING_BUF;
+		iov[i].iov_len = CP_URING_BUF;
+	}
+	r->fixed = syscall(__NR_io_uring_register, r->u.fd,
+			   IORING_REGISTER_BUFFERS, iov, URING_DEPTH) == 0;
+
+	return (r);
+}
+
+/**
+ * cp_uring - copies a regular file through io_uring
+ * @fd_from: file descriptor to read from, at offset 0
+ * @fd_to: empty file descriptor to write to
+ * @st: filled with the path used, the byte count and the time taken
+ *
+ * Description: URING_DEPTH reads and writes of CP_URING_BUF bytes
+ * are kept in flight through one ring, each buffer read then written
+ * at the same offset, so one system call submits and reaps a whole
+ * batch. The file offsets are left alone
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure, or -1
+ * with nothing copied if io_uring is unavailable or either file is
+ * not regular; the caller should then use cp_engine()
+ */
+int cp_uring(int fd_from, int fd_to, cp_stats_t *st)
+{
+	struct timespec t0, t1;
+	struct stat sb, db;
+	cp_ring_t *r;
+	int err;
+
+	if (fstat(fd_from, &sb) == -1 || !S_ISREG(sb.st_mode) ||
+	    sb.st_size == 0 || fstat(fd_to, &db) == -1 || !S_ISREG(db.st_mode))
+		return (-1);
+	r = cp_uring_open();
+	if (r == NULL)
+		return (-1);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	r->fd_from = fd_from, r->fd_to = fd_to, r->size = sb.st_size;
+	if (fallocate(fd_to, 0, 0, sb.st_size) == -1 &&
+	    ftruncate(fd_to, sb.st_size) == -1)
+		r->error = CP_ERR_WRITE;
+	err = cp_uring_run(r);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	st->method = r->fixed ? "io_uring fixed buffers" : "io_uring";
+	st->bytes = err ? 0 : r->size;
+	st->threads = 1;
+	st->seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+	uring_exit(&r->u);
+	/* I/Os may still be using the buffers after a ring failure */
+	if (r->inflight == 0)
+		free(r->buf);
+	free(r);
+
+	return (err);
+}
@@ -0,0 +1,34 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "main.h"
+
+/**
+ * main - check the code
+ * @ac: number of arguments
+ * @av: text, then the files to write it to
+ *
+ * Return: Always 0.
+ */
+int main(int ac, char **av)
+{
+	char **texts;
+	size_t res;
+	int i;
+
+	if (ac < 3)
+	{
+		dprintf(2, "Usage: %s text filename...\n", av[0]);
+		exit(1);
+	}
+	texts = malloc(sizeof(*texts) * (ac - 2));
+	if (texts == NULL)
+		return (1);
+	for (i = 0; i < ac - 2; i++)
+		texts[i] = av[1];
+	res = write_files(av + 2, texts, ac - 2, 0);
+	printf("-> %lu created\n", (unsigned long)res);
+	res = write_files(av + 2, texts, ac - 2, 1);
+	printf("-> %lu appended to\n", (unsigned long)res);
+	free(texts);
+	return (0);
+}
@@ -0,0 +1,212 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include "main.h"
+
+/* Bytes read at a time from a data extent */
+#define CP_SPARSE_BUF (1L << 20)
+
+/* Zero runs are found with this granularity, the usual block size */
+#define CP_SPARSE_BLOCK 4096
+
+/**
+ * struct cp_sparse_s - state of a cp_sparse() copy
+ * @fd_from: source file descriptor
+ * @fd_to: destination file descriptor
+ * @dirty: 1 if the destination held data before the copy
+ * @buf: CP_SPARSE_BUF bytes of scratch space
+ */
+typedef struct cp_sparse_s
+{
+	int fd_from;
+	int fd_to;
+	int dirty;
+	char *buf;
+} cp_sparse_t;
+
+/**
+ * cp_run - finds the end of a run of zero (or non-zero) blocks
+ * @buf: the data
+ * @n: size of the data
+ * @i: start of the run, on a block boundary
+ * @zero: 1 to find the end of zero blocks, 0 of non-zero blocks
+ *
+ * Return: offset of the first block that does not match, or @n
+ */
+static ssize_t cp_run(const char *buf, ssize_t n, ssize_t i, int zero)
+{
+	ssize_t bs;
+
+	for (; i < n; i += bs)
+	{
+		bs = n - i < CP_SPARSE_BLOCK ? n - i : CP_SPARSE_BLOCK;
+		if ((buf[i] == 0 && !memcmp(buf + i, buf + i + 1, bs - 1)) != zero)
+			break;
+	}
+
+	return (i);
+}
+
+/**
+ * cp_skip - leaves a run of zero bytes as a hole in the destination
+ * @fd: destination file descriptor
+ * @off: start of the run
+ * @len: length of the run
+ * @dirty: 1 if the destination may already hold data there
+ *
+ * Description: the destination already has its final size, so a run
+ * that was never written is read back as zeros; only a destination
+ * that held data before needs the blocks punched out
+ *
+ * Return: 0 on success, -1 on failure
+ */
+static int cp_skip(int fd, off_t off, off_t len, int dirty)
+{
+	char zero[CP_SPARSE_BLOCK];
+	off_t n;
+
+	if (!dirty || len == 0 ||
+	    fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+		      off, len) == 0)
+		return (0);
+	memset(zero, 0, sizeof(zero));
+	if (lseek(fd, off, SEEK_SET) == -1)
+		return (-1);
+	for (; len > 0; len -= n)
+	{
+		n = len < (off_t)sizeof(zero) ? len : (off_t)sizeof(zero);
+		if (cp_write_all(fd, zero, n) == -1)
+			return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * cp_extent - copies one data extent, leaving zero blocks as holes
+ * @cs: the copy
+ * @off: start of the extent
+ * @end: end of the extent
+ * @st: stats; st->bytes counts the bytes actually written
+ *
+ * Return: end of what was copied (less than @end if the source
+ * shrank), or -CP_ERR_READ / -CP_ERR_WRITE on failure
+ */
+static off_t cp_extent(cp_sparse_t *cs, off_t off, off_t end,
+		       cp_stats_t *st)
+{
+	ssize_t n, i, j;
+
+	while (off < end)
+	{
+		n = end - off < CP_SPARSE_BUF ? end - off : CP_SPARSE_BUF;
+		n = pread(cs->fd_from, cs->buf, n, off);
+		if (n == -1 && errno == EINTR)
+			continue;
+		if (n == -1)
+			return (-CP_ERR_READ);
+		if (n == 0)
+			break;
+		for (i = 0; i < n; i = j)
+		{
+			j = cp_run(cs->buf, n, i, 1);
+			if (cp_skip(cs->fd_to, off + i, j - i, cs->dirty) == -1)
+				return (-CP_ERR_WRITE);
+			i = j;
+			j = cp_run(cs->buf, n, i, 0);
+			if (j > i && lseek(cs->fd_to, off + i, SEEK_SET) == -1)
+				return (-CP_ERR_WRITE);
+			if (cp_write_all(cs->fd_to, cs->buf + i, j - i) == -1)
+				return (-CP_ERR_WRITE);
+			st->bytes += j - i;
+		}
+		off += n;
+	}
+
+	return (off);
+}
+
+/**
+ * cp_sparse_loop - walks the data extents and holes of the source
+ * @cs: the copy
+ * @size: size of the source
+ * @st: stats; st->bytes counts the bytes actually written
+ *
+ * Description: a file system without SEEK_DATA reports the whole
+ * file as one extent, which still gets its zero blocks skipped
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure
+ */
+static int cp_sparse_loop(cp_sparse_t *cs, off_t size, cp_stats_t *st)
+{
+	off_t pos = 0, data, hole;
+
+	while (pos < size)
+	{
+		data = lseek(cs->fd_from, pos, SEEK_DATA);
+		if (data == -1 && errno == ENXIO)
+			data = size;
+		hole = data == -1 ? -1 : lseek(cs->fd_from, data, SEEK_HOLE);
+		data = data == -1 ? pos : data;
+		hole = hole == -1 || hole > size ? size : hole;
+		if (cp_skip(cs->fd_to, pos, data - pos, cs->dirty) == -1)
+			return (CP_ERR_WRITE);
+		if (data >= size)
+			break;
+		pos = cp_extent(cs, data, hole, st);
+		if (pos < 0)
+			return (-pos);
+		if (pos < hole)
+			return (ftruncate(cs->fd_to, pos) == -1 ? CP_ERR_WRITE : 0);
+	}
+
+	return (0);
+}
+
+/**
+ * cp_sparse - copies a file, keeping its holes
+ * @fd_from: file descriptor to read from
+ * @fd_to: file descriptor to write to
+ * @force: 1 to copy this way even if the source has no holes
+ * @st: filled with the path used, the byte count and the time taken
+ *
+ * Description: the data extents of the source are found with
+ * SEEK_DATA and SEEK_HOLE, and within them every all-zero 4 KiB
+ * block is skipped too, so both the time taken and the space used
+ * by the copy follow the data, not the file size. The destination
+ * is sized with ftruncate(), which makes every skipped range a hole;
+ * if it held data before, those ranges are punched out. st->bytes
+ * counts the bytes written, not the size of the file
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure, or -1
+ * with nothing copied if either file is not regular or, unless
+ * @force is set, the source has no holes; use cp_engine() then
+ */
+int cp_sparse(int fd_from, int fd_to, int force, cp_stats_t *st)
+{
+	struct timespec t0, t1;
+	struct stat sb, db;
+	cp_sparse_t cs;
+	int err;
+
+	if (fstat(fd_from, &sb) == -1 || !S_ISREG(sb.st_mode) ||
+	    fstat(fd_to, &db) == -1 || !S_ISREG(db.st_mode) ||
+	    (!force && sb.st_blocks * 512 >= sb.st_size))
+		return (-1);
+	cs.buf = malloc(CP_SPARSE_BUF);
+	if (cs.buf == NULL)
+		return (-1);
+	cs.fd_from = fd_from, cs.fd_to = fd_to, cs.dirty = db.st_size > 0;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	st->method = "SEEK_DATA/SEEK_HOLE sparse";
+	st->bytes = 0;
+	st->threads = 1;
+	err = ftruncate(fd_to, sb.st_size) == -1 ? CP_ERR_WRITE :
+		cp_sparse_loop(&cs, sb.st_size, st);
+	free(cs.buf);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	st->seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+	return (err);
+}
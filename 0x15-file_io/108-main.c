@@ -0,0 +1,28 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "main.h"
+
+/**
+ * main - check the code
+ * @ac: number of arguments
+ * @av: file name, then optionally the number of letters to print
+ *
+ * Return: Always 0.
+ */
+int main(int ac, char **av)
+{
+	cp_stats_t st;
+	ssize_t n;
+
+	if (ac != 2 && ac != 3)
+	{
+		dprintf(2, "Usage: %s filename [letters]\n", av[0]);
+		exit(1);
+	}
+	n = read_textfile_stream(av[1], ac == 3 ? strtoul(av[2], NULL, 10) :
+				 (size_t)-1, &st);
+	dprintf(2, "\n(printed chars: %li, %s, %.3f s, %.1f MB/s)\n", (long)n,
+		st.method, st.seconds,
+		st.seconds > 0 ? st.bytes / 1e6 / st.seconds : 0.0);
+	return (0);
+}
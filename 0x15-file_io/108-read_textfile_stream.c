@@ -0,0 +1,134 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "main.h"
+
+/* Bytes of the file mapped at a time */
+#define RT_WINDOW (4L << 20)
+/* Buffer of the read()/write() path */
+#define RT_BUF (64L << 10)
+
+/**
+ * rt_mmap - prints a regular file from mappings of RT_WINDOW bytes
+ * @fd: file descriptor to read from
+ * @len: number of bytes to print, at most the size of the file
+ * @st: stats; bytes printed are added to st->bytes
+ *
+ * Description: each window is written straight from the page cache
+ * and unmapped before the next one, so at most RT_WINDOW bytes are
+ * mapped however large @len is
+ *
+ * Return: 0 on success, 1 if mmap() is not usable (nothing printed),
+ * -1 if a write failed
+ */
+static int rt_mmap(int fd, off_t len, cp_stats_t *st)
+{
+	off_t off, n;
+	char *map;
+
+	for (off = 0; off < len; off += n)
+	{
+		n = len - off < RT_WINDOW ? len - off : RT_WINDOW;
+		map = mmap(NULL, n, PROT_READ, MAP_SHARED, fd, off);
+		if (map == MAP_FAILED)
+			return (off == 0 ? 1 : -1);
+		madvise(map, n, MADV_SEQUENTIAL);
+		if (cp_write_all(STDOUT_FILENO, map, n) == -1)
+		{
+			munmap(map, n);
+			return (-1);
+		}
+		munmap(map, n);
+		st->bytes += n;
+	}
+
+	return (0);
+}
+
+/**
+ * rt_buffer - prints a file through a fixed RT_BUF byte buffer
+ * @fd: file descriptor to read from
+ * @letters: most bytes to print
+ * @st: stats; bytes printed are added to st->bytes
+ *
+ * Description: only a read of 0 bytes stops the loop early, so
+ * short reads from pipes and terminals are carried on
+ *
+ * Return: 0 on success, -1 if a read or a write failed
+ */
+static int rt_buffer(int fd, size_t letters, cp_stats_t *st)
+{
+	char *buf = malloc(RT_BUF);
+	ssize_t n = 1;
+	size_t left;
+
+	if (buf == NULL)
+		return (-1);
+	while ((size_t)st->bytes < letters && n != 0)
+	{
+		left = letters - st->bytes;
+		n = read(fd, buf, left < RT_BUF ? left : RT_BUF);
+		if (n == -1 && errno == EINTR)
+			continue;
+		if (n == -1 || cp_write_all(STDOUT_FILENO, buf, n) == -1)
+		{
+			free(buf);
+			return (-1);
+		}
+		st->bytes += n;
+	}
+	free(buf);
+
+	return (0);
+}
+
+/**
+ * read_textfile_stream - prints up to letters bytes of a file, streamed
+ * @filename: name of the file to print
+ * @letters: most bytes to print
+ * @st: filled with the path used, the byte count and the time taken
+ *
+ * Description: a regular file is mapped and written to stdout a
+ * window at a time; anything else, or a file mmap() refuses, goes
+ * through a fixed buffer. Memory use does not depend on @letters and
+ * short writes are resumed. As with any mapping, a file truncated by
+ * someone else while it is printed can raise SIGBUS
+ *
+ * Return: number of bytes printed, 0 if the file cannot be opened,
+ * or -1 if a read or a write failed part way (st->bytes then says
+ * how much was printed)
+ */
+ssize_t read_textfile_stream(const char *filename, size_t letters,
+			     cp_stats_t *st)
+{
+	struct timespec t0, t1;
+	struct stat sb;
+	int fd, ret = 1;
+	off_t len;
+
+	st->method = "read/write";
+	st->bytes = 0;
+	st->seconds = 0;
+	st->threads = 1;
+	if (filename == NULL)
+		return (0);
+	fd = open(filename, O_RDONLY);
+	if (fd == -1)
+		return (0);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	if (fstat(fd, &sb) == 0 && S_ISREG(sb.st_mode) && sb.st_size > 0)
+	{
+		len = (size_t)sb.st_size < letters ? sb.st_size : (off_t)letters;
+		ret = rt_mmap(fd, len, st);
+		if (ret != 1)
+			st->method = "mmap/write";
+	}
+	if (ret == 1)
+		ret = rt_buffer(fd, letters, st);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	st->seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+	close(fd);
+
+	return (ret == -1 ? -1 : (ssize_t)st->bytes);
+}
@@ -0,0 +1,190 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include "main.h"
+#include "uring.h"
+
+/* Result of a file whose completion has not been seen */
+#define WF_NONE INT_MIN
+
+/**
+ * wf_wait - submits the queued entries and reaps n completions
+ * @u: the ring
+ * @n: number of completions to wait for
+ * @res: where to store each result, indexed by its user_data
+ *
+ * Return: 0 on success, -1 if the ring failed
+ */
+static int wf_wait(uring_t *u, int n, int *res)
+{
+	struct io_uring_cqe cqe;
+
+	while (n > 0)
+	{
+		if (uring_submit(u, n) == -1 && errno != EAGAIN && errno != EBUSY)
+			return (-1);
+		while (uring_cqe(u, &cqe))
+		{
+			res[cqe.user_data] = cqe.res;
+			n--;
+		}
+	}
+
+	return (0);
+}
+
+/**
+ * wf_open - opens every file of a batch
+ * @u: the ring
+ * @b: the batch
+ *
+ * Description: a file the kernel cannot open through io_uring is
+ * left WF_TODO, to be written synchronously. If the ring fails, the
+ * files it did open are closed and left WF_TODO as well, since
+ * nothing was written to them yet
+ *
+ * Return: 0 on success, -1 if the ring failed
+ */
+static int wf_open(uring_t *u, wf_batch_t *b)
+{
+	struct io_uring_sqe *sqe;
+	int i, q = 0, err;
+
+	for (i = 0; i < b->n; i++)
+	{
+		b->fd[i] = -1, b->done[i] = 0, b->res[i] = WF_NONE;
+		if (b->names[i] == NULL)
+			continue;
+		sqe = uring_sqe(u);
+		sqe->opcode = IORING_OP_OPENAT;
+		sqe->fd = AT_FDCWD;
+		sqe->addr = (unsigned long)b->names[i];
+		sqe->len = S_IRUSR | S_IWUSR;
+		sqe->open_flags = b->append ? O_WRONLY | O_APPEND :
+			O_WRONLY | O_CREAT | O_TRUNC;
+		sqe->user_data = i;
+		q++;
+	}
+	err = wf_wait(u, q, b->res);
+	for (i = 0; i < b->n; i++)
+	{
+		if (b->res[i] >= 0 && err == -1)
+			close(b->res[i]);
+		else if (b->res[i] >= 0)
+			b->fd[i] = b->res[i];
+		else if (b->res[i] != WF_NONE && b->res[i] != -EINVAL &&
+			 b->res[i] != -EOPNOTSUPP)
+			b->state[i] = WF_FAILED;
+	}
+
+	return (err);
+}
+
+/**
+ * wf_pending - tells if a file still has text to write
+ * @b: the batch
+ * @i: index of the file
+ *
+ * Return: 1 if so, 0 otherwise
+ */
+static int wf_pending(const wf_batch_t *b, int i)
+{
+	return (b->fd[i] >= 0 && b->state[i] == WF_TODO && b->texts != NULL &&
+		b->texts[i] != NULL && b->texts[i][b->done[i]] != '\0');
+}
+
+/**
+ * wf_write - writes the text of every open file of a batch
+ * @u: the ring
+ * @b: the batch
+ *
+ * Description: short writes are queued again for the rest of the
+ * text. If the ring fails, a file whose text was not confirmed
+ * written is marked WF_FAILED: it may be partly written, and writing
+ * it again could append the text twice
+ *
+ * Return: 0 on success, -1 if the ring failed
+ */
+static int wf_write(uring_t *u, wf_batch_t *b)
+{
+	struct io_uring_sqe *sqe;
+	int i, q;
+
+	do {
+		for (i = 0, q = 0; i < b->n; i++)
+		{
+			if (!wf_pending(b, i))
+				continue;
+			sqe = uring_sqe(u);
+			sqe->opcode = IORING_OP_WRITE;
+			sqe->fd = b->fd[i];
+			sqe->off = b->append ? ~(__u64)0 : b->done[i];
+			sqe->addr = (unsigned long)(b->texts[i] + b->done[i]);
+			sqe->len = strlen(b->texts[i] + b->done[i]);
+			sqe->user_data = i;
+			q++;
+		}
+		if (wf_wait(u, q, b->res) == -1)
+		{
+			for (i = 0; i < b->n; i++)
+				if (wf_pending(b, i))
+					b->state[i] = WF_FAILED;
+			return (-1);
+		}
+		for (i = 0; i < b->n; i++)
+			if (wf_pending(b, i) && b->res[i] > 0)
+				b->done[i] += b->res[i];
+			else if (wf_pending(b, i) && b->res[i] != -EINTR &&
+				 b->res[i] != -EAGAIN)
+				b->state[i] = WF_FAILED;
+	} while (q > 0);
+
+	return (0);
+}
+
+/**
+ * write_files_batch - opens, writes and closes up to URING_DEPTH files
+ * @u: the ring
+ * @b: the batch, with every state set to WF_TODO
+ *
+ * Description: each step is queued for the whole batch and submitted
+ * in one system call. Every file opened here is closed again, through
+ * the ring or, if it failed, with close()
+ *
+ * Return: 0 on success, -1 if the ring failed; b->state then tells
+ * which files are settled and which are still WF_TODO
+ */
+int write_files_batch(uring_t *u, wf_batch_t *b)
+{
+	struct io_uring_sqe *sqe;
+	int i, q = 0, err;
+
+	if (wf_open(u, b) == -1)
+		return (-1);
+	err = wf_write(u, b);
+	for (i = 0; i < b->n; i++)
+	{
+		b->res[i] = WF_NONE;
+		if (b->fd[i] < 0 || err == -1)
+			continue;
+		sqe = uring_sqe(u);
+		sqe->opcode = IORING_OP_CLOSE;
+		sqe->fd = b->fd[i];
+		sqe->user_data = i;
+		q++;
+	}
+	if (err == 0)
+		err = wf_wait(u, q, b->res);
+	for (i = 0; i < b->n; i++)
+	{
+		if (b->fd[i] < 0)
+			continue;
+		if (b->res[i] == WF_NONE)
+			close(b->fd[i]);
+		if (b->state[i] == WF_TODO)
+			b->state[i] = WF_OK;
+	}
+
+	return (err);
+}
@@ -1,5 +1,18 @@
-#include "main.h"
-#include <stdio.h>
+#define _GNU_SOURCE
+#include "cp_inline.h"
+#include <string.h>
+
+/* The other copy paths are used only when their files are linked in */
+#pragma weak cp_parallel
+#pragma weak cp_uring
+#pragma weak cp_sparse
+
+/* Settings the chosen copy path ignored, for the CP_STATS line */
+#define CP_IGN_THREADS 1
+#define CP_IGN_URING 2
+
+static const char *const cp_notes[] = {"", " (CP_THREADS ignored)",
+	" (CP_URING ignored)", " (CP_THREADS and CP_URING ignored)"};
 
 /**
  * error_file - checks if files can be opened.
@@ -13,60 +26,110 @@ void error_file(int file_from, int file_to, char *argv[])
 	if (file_from == -1)
 	{
 		dprintf(STDERR_FILENO, "Error: Can't read from file %s\n", argv[1]);
-		exit(98);
+		exit(CP_ERR_READ);
 	}
 	if (file_to == -1)
 	{
 		dprintf(STDERR_FILENO, "Error: Can't write to %s\n", argv[2]);
-		exit(99);
+		exit(CP_ERR_WRITE);
+	}
+}
+
+/**
+ * close_file - closes a file descriptor or exits with 100.
+ * @fd: file descriptor to close.
+ */
+void close_file(int fd)
+{
+	if (close(fd) == -1)
+	{
+		dprintf(STDERR_FILENO, "Error: Can't close fd %d\n", fd);
+		exit(CP_ERR_CLOSE);
+	}
+}
+
+/**
+ * cp_copy - copies a file through the first copy path that applies
+ * @fd_from: file descriptor to read from
+ * @fd_to: file descriptor to write to
+ * @st: filled with the path used, the byte count and the time taken
+ * @ignored: set to the CP_IGN_* bits of the settings the path ignored
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure
+ */
+int cp_copy(int fd_from, int fd_to, cp_stats_t *st, int *ignored)
+{
+	char *sparse = getenv("CP_SPARSE");
+	int err = -1, used = 0, threads = 1;
+
+	*ignored = (getenv("CP_THREADS") != NULL ? CP_IGN_THREADS : 0) |
+		(getenv("CP_URING") != NULL ? CP_IGN_URING : 0);
+	if (*ignored & CP_IGN_THREADS)
+		threads = atoi(getenv("CP_THREADS"));
+	if (cp_sparse && (sparse == NULL || strcmp(sparse, "never") != 0))
+		err = cp_sparse(fd_from, fd_to,
+				sparse != NULL && strcmp(sparse, "always") == 0, st);
+	if (err == -1 && cp_uring && (*ignored & CP_IGN_URING))
+	{
+		err = cp_uring(fd_from, fd_to, st);
+		used = err == -1 ? 0 : CP_IGN_URING;
 	}
+	if (err == -1 && cp_parallel)
+	{
+		err = cp_parallel(fd_from, fd_to, threads, st);
+		used = CP_IGN_THREADS;
+	}
+	if (err == -1)
+		err = cp_engine_inline(fd_from, fd_to, st);
+	*ignored &= ~used;
+
+	return (err);
 }
 
 /**
- * main - check the code for Alx students.
+ * main - copies the content of a file to another file.
  * @argc: number of arguments.
  * @argv: arguments vector.
+ *
+ * Description: a source with holes is copied by cp_sparse(), which
+ * keeps them; CP_SPARSE=always also turns zero blocks of other files
+ * into holes and CP_SPARSE=never turns this off. Otherwise the data
+ * is moved by cp_engine_inline(), or by cp_parallel() on CP_THREADS
+ * threads if that is set in the environment, or through io_uring if
+ * CP_URING is set and the kernel allows it. Built from this file
+ * alone, cp only has cp_engine_inline(); the other paths are there
+ * when 103, 105 or 107 are linked in. The first path that applies wins:
+ * sparse, then io_uring, then threads, so a sparse copy ignores
+ * CP_THREADS and CP_URING, and CP_URING ignores CP_THREADS, as does
+ * a build without their paths. Set CP_STATS to get the path taken,
+ * any setting it ignored and the throughput on stderr.
+ *
  * Return: Always 0.
  */
 int main(int argc, char *argv[])
 {
-	int file_from, file_to, err_close;
-	ssize_t nchars, nwr;
-	char buf[1024];
+	int file_from, file_to, err, ignored;
+	cp_stats_t st;
 
 	if (argc != 3)
 	{
 		dprintf(STDERR_FILENO, "%s\n", "Usage: cp file_from file_to");
-		exit(97);
+		exit(CP_ERR_USAGE);
 	}
 
 	file_from = open(argv[1], O_RDONLY);
-	file_to = open(argv[2], O_CREAT | O_WRONLY | O_TRUNC | O_APPEND, 0664);
+	file_to = open(argv[2], O_CREAT | O_WRONLY | O_TRUNC, 0664);
 	error_file(file_from, file_to, argv);
 
-	nchars = 1024;
-	while (nchars == 1024)
-	{
-		nchars = read(file_from, buf, 1024);
-		if (nchars == -1)
-			error_file(-1, 0, argv);
-		nwr = write(file_to, buf, nchars);
-		if (nwr == -1)
-			error_file(0, -1, argv);
-	}
+	err = cp_copy(file_from, file_to, &st, &ignored);
+	if (err == CP_ERR_READ)
+		error_file(-1, 0, argv);
+	if (err == CP_ERR_WRITE)
+		error_file(0, -1, argv);
+	if (getenv("CP_STATS") != NULL)
+		cp_report_inline(argv[1], argv[2], &st, cp_notes[ignored]);
 
-	err_close = close(file_from);
-	if (err_close == -1)
-	{
-		dprintf(STDERR_FILENO, "Error: Can't close fd %d\n", file_from);
-		exit(100);
-	}
-
-	err_close = close(file_to);
-	if (err_close == -1)
-	{
-		dprintf(STDERR_FILENO, "Error: Can't close fd %d\n", file_from);
-		exit(100);
-	}
+	close_file(file_from);
+	close_file(file_to);
 	return (0);
 }
@@ -0,0 +1,52 @@
+#!/bin/bash
+# Times cp on 1, 2, 4... threads (up to twice the core count), then
+# through io_uring, copying a ${1:-1024} MiB file within each directory
+# given after it, then a sparse file of the same size, by default
+# /dev/shm (tmpfs) and the current directory (put it on the NVMe drive).
+# Page-cache state is not reset between runs; run as root with
+# DROP_CACHES=1 to drop caches before each copy.
+set -e
+mib=${1:-1024}
+shift || true
+dirs=("${@:-/dev/shm}")
+[ $# -eq 0 ] && dirs+=("$PWD")
+cd "$(dirname "$0")"
+out=$(mktemp -d)
+cleanup()
+{
+	rm -rf "$out"
+	for d in "${dirs[@]}"; do
+		rm -f "$d/.cp_bench_src" "$d/.cp_bench_src.sparse" \
+			"$d/.cp_bench_dst"
+	done
+}
+trap cleanup EXIT
+gcc -Wall -pedantic -Werror -Wextra -O2 -pthread ../3-cp.c \
+	../101-cp_engine.c ../102-cp_read_write.c ../103-cp_parallel.c \
+	../104-uring.c ../105-cp_uring.c ../107-cp_sparse.c -o "$out/cp"
+max=$((2 * $(nproc)))
+for d in "${dirs[@]}"; do
+	src="$d/.cp_bench_src"
+	dst="$d/.cp_bench_dst"
+	head -c $((mib << 20)) /dev/urandom > "$src"
+	for ((t = 1; t <= max; t *= 2)); do
+		[ -n "$DROP_CACHES" ] && sync && echo 3 > /proc/sys/vm/drop_caches
+		CP_STATS=1 CP_THREADS=$t "$out/cp" "$src" "$dst"
+		cmp "$src" "$dst"
+		rm -f "$dst"
+	done
+	[ -n "$DROP_CACHES" ] && sync && echo 3 > /proc/sys/vm/drop_caches
+	CP_STATS=1 CP_URING=1 "$out/cp" "$src" "$dst"
+	cmp "$src" "$dst"
+	rm -f "$dst"
+	# Same size again, sparse: 1 MiB of data every 64 MiB
+	truncate -s $((mib << 20)) "$src.sparse"
+	for ((m = 0; m < mib; m += 64)); do
+		head -c $((1 << 20)) /dev/urandom |
+			dd of="$src.sparse" bs=1M seek=$m conv=notrunc status=none
+	done
+	CP_STATS=1 "$out/cp" "$src.sparse" "$dst"
+	cmp "$src.sparse" "$dst"
+	du -h "$src.sparse" "$dst"
+	rm -f "$dst" "$src.sparse"
+done
@@ -0,0 +1,167 @@
+#ifndef CP_INLINE_H
+#define CP_INLINE_H
+
+#include <errno.h>
+#include <stdio.h>
+#include <time.h>
+#include <sys/sendfile.h>
+#include "main.h"
+
+/*
+ * Inlinable copy engine, so that 3-cp.c builds on its own; 101 and
+ * 102 export the same code as cp_engine(), cp_report(),
+ * cp_write_all() and cp_read_write(). copy_file_range() needs
+ * _GNU_SOURCE defined before the first #include.
+ */
+
+/* Bytes asked of the kernel per zero-copy call */
+#define CP_CHUNK (1L << 30)
+/* The read/write buffer starts small and doubles up to this size */
+#define CP_BUF_MIN (128L << 10)
+#define CP_BUF_MAX (8L << 20)
+
+/**
+ * cp_write_all_inline - writes a whole buffer, resuming short writes
+ * @fd: file descriptor to write to
+ * @buf: bytes to write
+ * @len: number of bytes
+ *
+ * Return: len on success, -1 on error
+ */
+static __inline__ ssize_t cp_write_all_inline(int fd, const char *buf,
+					      size_t len)
+{
+	size_t done = 0;
+	ssize_t n;
+
+	while (done < len)
+	{
+		n = write(fd, buf + done, len - done);
+		if (n == -1 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return (-1);
+		done += n;
+	}
+
+	return (len);
+}
+
+/**
+ * cp_read_write_inline - copies with read() and write() until EOF
+ * @fd_from: file descriptor to read from
+ * @fd_to: file descriptor to write to
+ * @st: stats; bytes copied are added to st->bytes
+ *
+ * Description: only a read of 0 bytes ends the copy, so short reads
+ * from pipes and terminals are not mistaken for end of file. The
+ * buffer doubles each time a read fills it, so large files get
+ * large transfers while small ones stay cheap
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure
+ */
+static __inline__ int cp_read_write_inline(int fd_from, int fd_to,
+					   cp_stats_t *st)
+{
+	size_t size = CP_BUF_MIN;
+	char *buf = malloc(size), *bigger;
+	ssize_t n;
+
+	if (buf == NULL)
+		return (CP_ERR_READ);
+	while ((n = read(fd_from, buf, size)) != 0)
+	{
+		if (n == -1 && errno == EINTR)
+			continue;
+		if (n == -1)
+			break;
+		if (cp_write_all_inline(fd_to, buf, n) == -1)
+		{
+			free(buf);
+			return (CP_ERR_WRITE);
+		}
+		st->bytes += n;
+		if ((size_t)n == size && size < CP_BUF_MAX)
+		{
+			bigger = malloc(size * 2);
+			if (bigger != NULL)
+			{
+				free(buf);
+				buf = bigger;
+				size *= 2;
+			}
+		}
+	}
+	free(buf);
+
+	return (n == 0 ? 0 : CP_ERR_READ);
+}
+
+/**
+ * cp_engine_inline - copies everything left in fd_from to fd_to
+ * @fd_from: file descriptor to read from
+ * @fd_to: file descriptor to write to (not opened with O_APPEND)
+ * @st: filled with the path used, the byte count and the time taken
+ *
+ * Description: tries copy_file_range(), then sendfile(), then a
+ * read/write loop with a growing buffer; a path that fails part way
+ * hands over at the current offsets, so nothing is copied twice.
+ * The zero-copy paths are only tried on regular files that report a
+ * size: files in /proc and /sys claim to be empty and some kernels
+ * then make those calls return 0 as if at end of file
+ *
+ * Return: 0 on success, CP_ERR_READ or CP_ERR_WRITE on failure
+ */
+static __inline__ int cp_engine_inline(int fd_from, int fd_to,
+				       cp_stats_t *st)
+{
+	struct timespec t0, t1;
+	struct stat sb;
+	int ret = 0;
+	ssize_t n = -1;
+
+	st->bytes = 0;
+	st->threads = 1;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	if (fstat(fd_from, &sb) == 0 && S_ISREG(sb.st_mode) && sb.st_size > 0)
+	{
+		st->method = "copy_file_range";
+		while ((n = copy_file_range(fd_from, NULL, fd_to, NULL,
+					    CP_CHUNK, 0)) > 0)
+			st->bytes += n;
+		if (n != 0)
+			st->method = "sendfile";
+		while (n != 0 && (n = sendfile(fd_to, fd_from, NULL, CP_CHUNK)) > 0)
+			st->bytes += n;
+	}
+	if (n != 0)
+	{
+		st->method = "read/write";
+		ret = cp_read_write_inline(fd_from, fd_to, st);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	st->seconds = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+	return (ret);
+}
+
+/**
+ * cp_report_inline - prints the path and throughput of a copy
+ * @from: source file name
+ * @to: destination file name
+ * @st: stats of the copy
+ * @note: appended to the path name, e.g. settings it ignored, or ""
+ */
+static __inline__ void cp_report_inline(const char *from, const char *to,
+					const cp_stats_t *st, const char *note)
+{
+	double mb = st->bytes / 1e6;
+
+	dprintf(STDERR_FILENO, "cp: %s -> %s: %s%s, %.0f bytes in %.3f s",
+		from, to, st->method, note, (double)st->bytes, st->seconds);
+	dprintf(STDERR_FILENO, " (%.1f MB/s) on %d thread%s\n",
+		st->seconds > 0 ? mb / st->seconds : 0.0, st->threads,
+		st->threads > 1 ? "s" : "");
+}
+
+#endif
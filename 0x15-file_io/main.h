@@ -7,8 +7,40 @@
 #include <unistd.h>
 #include <stdlib.h>
 
+/* Exit codes of cp; the copy engine returns the last two */
+#define CP_ERR_USAGE 97
+#define CP_ERR_READ 98
+#define CP_ERR_WRITE 99
+#define CP_ERR_CLOSE 100
+
+/**
+ * struct cp_stats_s - what a cp_engine() copy did
+ * @method: name of the path that moved the data
+ * @bytes: number of bytes copied
+ * @seconds: wall-clock time of the copy
+ * @threads: number of threads that copied
+ */
+typedef struct cp_stats_s
+{
+	const char *method;
+	off_t bytes;
+	double seconds;
+	int threads;
+} cp_stats_t;
+
 ssize_t read_textfile(const char *filename, size_t letters);
 int create_file(const char *filename, char *text_content);
 int append_text_to_file(const char *filename, char *text_content);
 
+int cp_engine(int fd_from, int fd_to, cp_stats_t *st);
+void cp_report(const char *from, const char *to, const cp_stats_t *st);
+ssize_t cp_write_all(int fd, const char *buf, size_t len);
+int cp_read_write(int fd_from, int fd_to, cp_stats_t *st);
+int cp_parallel(int fd_from, int fd_to, int threads, cp_stats_t *st);
+int cp_uring(int fd_from, int fd_to, cp_stats_t *st);
+int cp_sparse(int fd_from, int fd_to, int force, cp_stats_t *st);
+size_t write_files(char **names, char **texts, size_t n, int append);
+ssize_t read_textfile_stream(const char *filename, size_t letters,
+			     cp_stats_t *st);
+
 #endif
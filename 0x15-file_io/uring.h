@@ -0,0 +1,124 @@
+#ifndef URING_H
+#define URING_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/*
+ * Minimal io_uring access through the raw system calls, for the
+ * optional asynchronous paths of the file_io tools. Not part of the
+ * main.h interface.
+ */
+
+/* Submission queue depth used by the tools */
+#define URING_DEPTH 64
+
+/**
+ * struct uring_s - a mapped io_uring instance
+ * @fd: ring file descriptor
+ * @sq_head: kernel-owned submission head
+ * @sq_tail: submission tail, advanced by us
+ * @sq_mask: submission index mask
+ * @sq_array: submission index array
+ * @cq_head: completion head, advanced by us
+ * @cq_tail: kernel-owned completion tail
+ * @cq_mask: completion index mask
+ * @sqes: submission queue entries
+ * @cqes: completion queue entries
+ * @sq_ring: mapping holding the submission ring
+ * @cq_ring: mapping holding the completion ring
+ * @sq_len: size of @sq_ring
+ * @cq_len: size of @cq_ring
+ * @sqes_len: size of the @sqes mapping
+ * @queued: entries filled in but not yet made visible to the kernel
+ */
+typedef struct uring_s
+{
+	int fd;
+	unsigned int *sq_head;
+	unsigned int *sq_tail;
+	unsigned int *sq_mask;
+	unsigned int *sq_array;
+	unsigned int *cq_head;
+	unsigned int *cq_tail;
+	unsigned int *cq_mask;
+	struct io_uring_sqe *sqes;
+	struct io_uring_cqe *cqes;
+	void *sq_ring;
+	void *cq_ring;
+	size_t sq_len;
+	size_t cq_len;
+	size_t sqes_len;
+	unsigned int queued;
+} uring_t;
+
+/* Outcome of each file of a write_files() batch */
+#define WF_TODO 0
+#define WF_OK 1
+#define WF_FAILED -1
+
+/**
+ * struct wf_batch_s - up to URING_DEPTH files written by write_files()
+ * @names: file names
+ * @texts: text of each file, or NULL; a NULL array means no text
+ * @n: number of files
+ * @append: 1 to append to existing files, 0 to create or truncate
+ * @state: WF_OK or WF_FAILED once a file is settled; WF_TODO files
+ * still have to be written, synchronously
+ * @fd: descriptor of each open file, or -1
+ * @done: bytes of each text written so far
+ * @res: result of each file's last completion
+ */
+typedef struct wf_batch_s
+{
+	char **names;
+	char **texts;
+	int n;
+	int append;
+	int state[URING_DEPTH];
+	int fd[URING_DEPTH];
+	size_t done[URING_DEPTH];
+	int res[URING_DEPTH];
+} wf_batch_t;
+
+int uring_init(uring_t *u, unsigned int entries);
+void uring_exit(uring_t *u);
+struct io_uring_sqe *uring_sqe(uring_t *u);
+int uring_submit(uring_t *u, unsigned int wait);
+int uring_cqe(uring_t *u, struct io_uring_cqe *cqe);
+int write_files_batch(uring_t *u, wf_batch_t *b);
+
+/**
+ * uring_probe - checks that the kernel supports some opcodes
+ * @u: ring
+ * @ops: the opcodes
+ * @n: number of opcodes
+ *
+ * Description: a kernel older than 5.6 sets up a ring but fails
+ * IORING_OP_READ, IORING_OP_WRITE and friends with -EINVAL on every
+ * use; it lacks IORING_REGISTER_PROBE too, so this returns 0 there
+ *
+ * Return: 1 if every opcode is supported, 0 otherwise
+ */
+static __inline__ int uring_probe(const uring_t *u, const __u8 *ops, int n)
+{
+	struct io_uring_probe *probe;
+	int i, ok;
+
+	probe = calloc(1, sizeof(*probe) + 256 * sizeof(probe->ops[0]));
+	if (probe == NULL)
+		return (0);
+	ok = syscall(__NR_io_uring_register, u->fd, IORING_REGISTER_PROBE,
+		     probe, 256) == 0;
+	for (i = 0; ok && i < n; i++)
+		ok = ops[i] <= probe->last_op &&
+			(probe->ops[ops[i]].flags & IO_URING_OP_SUPPORTED);
+	free(probe);
+
+	return (ok);
+}
+
+#endif